@@ -37,10 +37,16 @@ public:
 
     ComputePipelineBuilder& SetComputeShader(const std::shared_ptr<ComputeShader>& compShader);
 
+    /// @brief Sets the cache the module of the compute shader is acquired from.
+    /// @param shaderModuleCache Device-wide module cache, nullptr for a module owned by the shader
+    /// @return Reference to this builder for method chaining
+    ComputePipelineBuilder& SetShaderModuleCache(ShaderModuleCache* const shaderModuleCache);
+
 protected:
     // Protected Fields
 
-    std::shared_ptr<Shader> _compShader; /// @brief Compute shader to be used in the pipeline
+    std::shared_ptr<Shader> _compShader;               /// @brief Compute shader to be used in the pipeline
+    ShaderModuleCache* _shaderModuleCache{nullptr};    /// @brief Optional module cache, not owned
 
     // Protected Methods
 
@@ -0,0 +1,36 @@
+/// @file    BoundingVolume.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:52:19
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <velecs/math/Mat4.hpp>
+using velecs::math::Mat4;
+
+namespace velecs::graphics {
+
+/// @struct BoundingVolume
+/// @brief Local space bounding sphere and axis aligned box sharing the same center.
+///
+/// The sphere gives a cheap early rejection, the box a tighter test for
+/// elongated meshes.
+struct BoundingVolume {
+    float center[3]{0.0f, 0.0f, 0.0f};  /// @brief Center of the box and of the sphere.
+    float radius{0.0f};                 /// @brief Radius of the sphere.
+    float extents[3]{0.0f, 0.0f, 0.0f}; /// @brief Half size of the box along each axis.
+
+    /// @brief Transforms the volume into the space of a matrix.
+    /// @details The result stays conservative: the radius is scaled by the largest axis scale
+    /// and the box becomes the axis aligned box enclosing the rotated one.
+    /// @param worldMatrix Column-major matrix, usually the world matrix of the bounds.
+    /// @return The transformed volume.
+    BoundingVolume Transform(const Mat4& worldMatrix) const;
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,34 @@
+/// @file    CullStats.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 15:31:06
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @struct CullStats
+/// @brief Throughput of the last FrustumCuller::Cull() call.
+struct CullStats {
+    size_t objectCount{0};    /// @brief Number of objects tested.
+    size_t visibleCount{0};   /// @brief Number of objects at least partially inside the frustum.
+    uint32_t taskCount{0};    /// @brief Number of tasks the objects were split across, each on its own thread.
+    double milliseconds{0.0}; /// @brief Wall time of the cull, including merging the visible lists.
+
+    /// @brief Gets the number of objects tested per millisecond by each thread that took part.
+    inline double GetObjectsPerMillisecondPerCore() const
+    {
+        if (milliseconds <= 0.0 || taskCount == 0) return 0.0;
+        return static_cast<double>(objectCount) / milliseconds / static_cast<double>(taskCount);
+    }
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,42 @@
+/// @file    Frustum.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:52:19
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Culling/BoundingVolume.hpp"
+
+#include <velecs/math/Mat4.hpp>
+using velecs::math::Mat4;
+
+namespace velecs::graphics {
+
+/// @struct Frustum
+/// @brief Six world space planes bounding what a camera sees.
+///
+/// Plane normals point inside the frustum and are normalized, so the plane
+/// equation gives signed distances. Laid out as six vec4s for shaders.
+struct Frustum {
+    float planes[6][4]{}; /// @brief Left, right, bottom, top, near and far planes as (normal, distance).
+
+    /// @brief Extracts the planes of a camera.
+    /// @details Matrices are column-major, as uploaded to shaders, with a [0, 1] clip depth range.
+    /// @param projection Projection matrix of the camera.
+    /// @param view View matrix of the camera.
+    /// @return The world space frustum.
+    static Frustum FromCamera(const Mat4& projection, const Mat4& view);
+
+    /// @brief Checks if a bounding volume transformed by a world matrix is at least partially inside.
+    /// @param bounds Local space bounds.
+    /// @param worldMatrix Column-major world matrix of the bounds.
+    /// @return True if the volume may be visible, false if it is fully outside a plane.
+    bool Intersects(const BoundingVolume& bounds, const Mat4& worldMatrix) const;
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,109 @@
+/// @file    FrustumCuller.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 15:31:06
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Culling/BoundingVolume.hpp"
+#include "velecs/graphics/Culling/CullStats.hpp"
+#include "velecs/graphics/Culling/Frustum.hpp"
+#include "velecs/graphics/Threading/WorkerPool.hpp"
+
+#include <velecs/math/Mat4.hpp>
+using velecs::math::Mat4;
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @class FrustumCuller
+/// @brief Tests world space bounds against a frustum on the CPU.
+///
+/// Bounds are stored as structure of arrays so the planes can be tested against
+/// several objects at once: 8 with AVX2, 4 with SSE2 or NEON, 1 otherwise. The
+/// instruction set is picked at compile time. Large sets are split into chunks run
+/// on the worker pool, and the visible indices are merged back in ascending order.
+class FrustumCuller {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const size_t MIN_OBJECTS_PER_TASK; /// @brief Smallest chunk worth handing to a worker.
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    FrustumCuller() = default;
+
+    /// @brief Default deconstructor.
+    ~FrustumCuller() = default;
+
+    FrustumCuller(const FrustumCuller&) = delete;
+    FrustumCuller& operator=(const FrustumCuller&) = delete;
+
+    // Public Methods
+
+    /// @brief Sets the number of objects, keeping the bounds of the first ones.
+    /// @param objectCount Number of objects tested by the next Cull().
+    void Resize(const size_t objectCount);
+
+    /// @brief Sets the bounds of an object.
+    /// @param index Index of the object, below the size given to Resize().
+    /// @param bounds Local space bounds.
+    /// @param worldMatrix Column-major world matrix of the bounds.
+    void SetBounds(const size_t index, const BoundingVolume& bounds, const Mat4& worldMatrix);
+
+    /// @brief Finds the objects at least partially inside a frustum.
+    /// @param frustum Frustum to test against.
+    /// @param workerPool Pool running the chunks, the calling thread runs the first one.
+    /// @return Indices of the visible objects in ascending order, valid until the next call.
+    const std::vector<uint32_t>& Cull(const Frustum& frustum, WorkerPool& workerPool);
+
+    /// @brief Gets the number of objects.
+    inline size_t GetObjectCount() const { return _radius.size(); }
+
+    /// @brief Gets the indices found visible by the last Cull().
+    inline const std::vector<uint32_t>& GetVisible() const { return _visible; }
+
+    /// @brief Gets the throughput of the last Cull().
+    inline const CullStats& GetStats() const { return _stats; }
+
+    /// @brief Gets the name of the instruction set the culler was compiled for.
+    static const char* GetKernelName();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // World space bounds, one entry per object
+    std::vector<float> _centerX;
+    std::vector<float> _centerY;
+    std::vector<float> _centerZ;
+    std::vector<float> _radius;
+    std::vector<float> _extentX;
+    std::vector<float> _extentY;
+    std::vector<float> _extentZ;
+
+    std::vector<std::vector<uint32_t>> _taskVisible; /// @brief Visible indices found by each task.
+    std::vector<uint32_t> _visible;                  /// @brief Merged visible indices.
+    CullStats _stats;
+
+    // Private Methods
+
+    void CullRange(const Frustum& frustum, const size_t begin, const size_t end, std::vector<uint32_t>& visible) const;
+};
+
+} // namespace velecs::graphics
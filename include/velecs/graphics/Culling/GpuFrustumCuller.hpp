@@ -0,0 +1,102 @@
+/// @file    GpuFrustumCuller.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:52:19
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Culling/Frustum.hpp"
+#include "velecs/graphics/Memory/IndirectDrawBuffers.hpp"
+#include "velecs/graphics/Shader/ShaderPrograms/ComputeShaderProgram.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace velecs::graphics {
+
+/// @struct FrustumCullPushConstant
+/// @brief Push constant of the frustum culling compute shader, exactly the guaranteed 128 bytes.
+struct FrustumCullPushConstant {
+    float planes[6][4];            /// @brief World space frustum planes.
+    VkDeviceAddress objectBuffer;  /// @brief ObjectData of every draw.
+    VkDeviceAddress commandBuffer; /// @brief Compacted VkDrawIndexedIndirectCommand output.
+    VkDeviceAddress countBuffer;   /// @brief Visible draw count of each bucket, zeroed before the dispatch.
+    uint32_t drawCount;            /// @brief Number of ObjectData to test.
+    uint32_t padding;
+};
+
+/// @class GpuFrustumCuller
+/// @brief Culls indirect draws against a camera frustum in a compute shader.
+///
+/// Runs internal/shaders/frustum_cull.comp.spv with one invocation per draw and
+/// WORKGROUP_SIZE invocations per workgroup. Each invocation tests the bounding
+/// sphere then the box of its ObjectData, and visible draws append their command
+/// to the range of their bucket:
+/// commands[bucketFirstDraw + atomicAdd(counts[bucket], 1)] = {indexCount, 1, 0, 0, drawIndex}.
+/// Indirect calls then read the compacted ranges and the per bucket counts.
+class GpuFrustumCuller {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const uint32_t WORKGROUP_SIZE; /// @brief Local size of the culling shader.
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    GpuFrustumCuller() = default;
+
+    /// @brief Default deconstructor.
+    ~GpuFrustumCuller() = default;
+
+    GpuFrustumCuller(const GpuFrustumCuller&) = delete;
+    GpuFrustumCuller& operator=(const GpuFrustumCuller&) = delete;
+
+    // Public Methods
+
+    /// @brief Loads the culling shader and creates its pipeline.
+    /// @param device Device the pipeline is created on.
+    /// @param pipelineCache Cache the pipeline is created with, optional.
+    /// @param shaderModuleCache Cache the shader module is acquired from, optional.
+    /// @param pipelineLayoutCache Cache the pipeline layout is generated with, optional.
+    /// @return True on success, false otherwise.
+    bool Init(
+        const VkDevice device,
+        PipelineCache* const pipelineCache = nullptr,
+        ShaderModuleCache* const shaderModuleCache = nullptr,
+        PipelineLayoutCache* const pipelineLayoutCache = nullptr
+    );
+
+    /// @brief Destroys the pipeline.
+    void Cleanup();
+
+    /// @brief Records the culling dispatch and the barrier making its output readable by indirect draws.
+    /// @details Must be recorded outside of rendering, before the indirect draws. The draw counts must be zero.
+    /// @param cmd Command buffer of a queue family supporting compute.
+    /// @param frustum Camera frustum.
+    /// @param draws Buffers of the frame, their ObjectData already written.
+    /// @param drawCount Number of draws to test.
+    void Dispatch(const VkCommandBuffer cmd, const Frustum& frustum, const IndirectDrawBuffers& draws, const uint32_t drawCount);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::unique_ptr<ComputeShaderProgram> _program;
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "velecs/graphics/PipelineLayoutCache.hpp"
+
 #include <vulkan/vulkan_core.h>
 
 #include <vector>
@@ -47,6 +49,11 @@ public:
         const VkDescriptorSetLayoutCreateFlags flags = 0
     );
 
+    /// @brief Gets the layout from a cache, shared with the programs generating the same bindings from reflection.
+    /// @details The layout is owned by the cache.
+    /// @throws std::runtime_error if the layout cannot be created
+    VkDescriptorSetLayout Build(PipelineLayoutCache& cache, const VkShaderStageFlags stageFlags);
+
 protected:
     // Protected Fields
 
@@ -0,0 +1,93 @@
+/// @file    DrawPacket.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 16:08:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace velecs::graphics {
+
+/// @enum DrawPass
+/// @brief Pass a draw belongs to, the most significant part of its sort key.
+enum class DrawPass : uint8_t {
+    Opaque,      /// @brief Sorted front to back within a state run for early depth rejection.
+    Transparent, /// @brief Sorted back to front within a state run for correct blending.
+};
+
+/// @struct DrawPacket
+/// @brief Sort key of a render object and its index in the render list.
+///
+/// From the most to the least significant bits the key packs the pass, the
+/// pipeline, the material, the mesh and the depth, so sorting the keys groups
+/// draws sharing state into runs that are bound once. Pipeline, material and mesh
+/// are dense ids assigned per frame, ids above their maximum are clamped, which only
+/// costs extra binds since runs are still split by the actual objects.
+struct DrawPacket {
+    // Public Fields
+
+    static const uint32_t PASS_BITS = 2;
+    static const uint32_t PIPELINE_BITS = 12;
+    static const uint32_t MATERIAL_BITS = 14;
+    static const uint32_t MESH_BITS = 16;
+    static const uint32_t DEPTH_BITS = 20;
+
+    static const uint32_t MAX_PIPELINE_ID = (1u << PIPELINE_BITS) - 1;
+    static const uint32_t MAX_MATERIAL_ID = (1u << MATERIAL_BITS) - 1;
+    static const uint32_t MAX_MESH_ID = (1u << MESH_BITS) - 1;
+    static const uint32_t MAX_DEPTH = (1u << DEPTH_BITS) - 1;
+
+    static_assert(PASS_BITS + PIPELINE_BITS + MATERIAL_BITS + MESH_BITS + DEPTH_BITS == 64);
+
+    uint64_t key{0};    /// @brief Sort key, draws are recorded in ascending order.
+    uint32_t object{0}; /// @brief Index of the render object in the render list.
+
+    // Public Methods
+
+    /// @brief Packs a sort key.
+    /// @param pass Pass of the draw.
+    /// @param pipelineId Dense id of the draw's pipeline.
+    /// @param materialId Dense id of the draw's material.
+    /// @param meshId Dense id of the draw's mesh.
+    /// @param distanceSquared Squared distance from the camera to the draw's bounds.
+    /// @return The key.
+    static inline uint64_t MakeKey(
+        const DrawPass pass,
+        const uint32_t pipelineId,
+        const uint32_t materialId,
+        const uint32_t meshId,
+        const float distanceSquared
+    )
+    {
+        uint32_t depth = QuantizeDepth(distanceSquared);
+        if (pass == DrawPass::Transparent) depth = MAX_DEPTH - depth;
+
+        uint64_t key = static_cast<uint64_t>(pass);
+        key = (key << PIPELINE_BITS) | (pipelineId < MAX_PIPELINE_ID ? pipelineId : MAX_PIPELINE_ID);
+        key = (key << MATERIAL_BITS) | (materialId < MAX_MATERIAL_ID ? materialId : MAX_MATERIAL_ID);
+        key = (key << MESH_BITS) | (meshId < MAX_MESH_ID ? meshId : MAX_MESH_ID);
+        key = (key << DEPTH_BITS) | depth;
+        return key;
+    }
+
+    /// @brief Maps a non-negative distance to DEPTH_BITS while keeping its order.
+    /// @details The bits of a positive float increase with its value, so the top bits of
+    /// exponent and mantissa give a logarithmic depth without needing the camera range.
+    static inline uint32_t QuantizeDepth(const float distanceSquared)
+    {
+        if (!(distanceSquared > 0.0f)) return 0;
+
+        uint32_t bits;
+        std::memcpy(&bits, &distanceSquared, sizeof(bits));
+        return bits >> (32 - 1 - DEPTH_BITS);
+    }
+};
+
+} // namespace velecs::graphics
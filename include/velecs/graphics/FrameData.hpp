@@ -10,10 +10,16 @@
 
 #pragma once
 
-#include "velecs/graphics/Memory/DeletionQueue.hpp"
+#include "velecs/graphics/Memory/AllocatedBuffer.hpp"
+#include "velecs/graphics/Memory/IndirectDrawBuffers.hpp"
+#include "velecs/graphics/Memory/InstanceBuffer.hpp"
 
 #include <vulkan/vulkan_core.h>
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 namespace velecs::graphics {
 
 /// @struct FrameData
@@ -29,11 +35,20 @@ public:
     VkCommandPool commandPool{nullptr};
 	VkCommandBuffer mainCommandBuffer{nullptr};
 
+    std::vector<VkCommandPool> workerCommandPools;     /// @brief One pool per recording worker, pools are not thread safe.
+    std::vector<VkCommandBuffer> workerCommandBuffers; /// @brief Secondary command buffers allocated from the matching worker pool.
+
+    VkCommandPool computeCommandPool{nullptr};     /// @brief Pool of the async compute queue family (async compute only).
+    VkCommandBuffer computeCommandBuffer{nullptr}; /// @brief Records the AsyncCompute passes, submitted before mainCommandBuffer.
+
     VkSemaphore swapchainSemaphore{nullptr};
 
-    VkFence renderFence{nullptr};
+    uint64_t timelineValue{0}; /// @brief Frame value of the last submission using this frame, 0 if never submitted.
 
-    DeletionQueue deletionQueue;
+    std::unique_ptr<AllocatedBuffer> readbackBuffer; /// @brief Host visible copy of the draw image (headless mode only).
+
+    IndirectDrawBuffers indirectDraws; /// @brief Draw records of the geometry pass (indirect draw only).
+    InstanceBuffer instances;          /// @brief Per-instance data of the geometry pass (instancing only).
 
     // Constructors and Destructors
 
@@ -43,6 +58,12 @@ public:
     /// @brief Default deconstructor.
     ~FrameData() = default;
 
+    // Frames are stored in a vector sized at init time, so they must be movable
+    FrameData(const FrameData&) = delete;
+    FrameData& operator=(const FrameData&) = delete;
+    FrameData(FrameData&&) = default;
+    FrameData& operator=(FrameData&&) = default;
+
     // Public Methods
 
 protected:
@@ -10,14 +10,19 @@
 
 #pragma once
 
+#include "velecs/graphics/Memory/BindlessHeap.hpp"
+
 #include <velecs/common/Uuid.hpp>
 using velecs::common::Uuid;
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 
 namespace velecs::graphics {
 
+struct RasterizationShaderProgram;
+
 /// @class Material
 /// @brief Brief description.
 ///
@@ -50,6 +55,23 @@ public:
         // _programHandle = uuid;
     }
 
+    /// @brief Sets the program used to draw meshes with this material.
+    /// @param program Program registered with the render engine, not owned by the material.
+    inline void SetShaderProgram(const RasterizationShaderProgram* const program) { _program = program; }
+
+    /// @brief Gets the program used to draw meshes with this material.
+    /// @return The program, or nullptr if none was set.
+    inline const RasterizationShaderProgram* GetShaderProgram() const { return _program; }
+
+    /// @brief Sets the bindless heap index shaders find the material's resources at.
+    /// @details Passed to draws in ObjectPushConstant::bindlessIndex or ObjectData::bindlessIndex.
+    /// @param bindlessIndex Index returned by a BindlessHeap Register method.
+    inline void SetBindlessIndex(const uint32_t bindlessIndex) { _bindlessIndex = bindlessIndex; }
+
+    /// @brief Gets the bindless heap index of the material's resources.
+    /// @return The index, or BindlessHeap::INVALID_INDEX if none was set.
+    inline uint32_t GetBindlessIndex() const { return _bindlessIndex; }
+
 protected:
     // Protected Fields
 
@@ -59,6 +81,8 @@ private:
     // Private Fields
 
     std::optional<Uuid> _programHandle;
+    const RasterizationShaderProgram* _program{nullptr}; /// @brief Non-owning, the render engine owns its programs.
+    uint32_t _bindlessIndex{BindlessHeap::INVALID_INDEX};
 
     // Private Methods
 };
@@ -63,6 +63,22 @@ public:
         VmaMemoryUsage memoryUsage
     );
 
+    /// @brief Gets the size requested when the buffer was created
+    /// @return Buffer size in bytes
+    inline VkDeviceSize GetSize() const { return _size; }
+
+    /// @brief Gets the persistently mapped pointer of the buffer
+    /// @return Pointer to the mapped memory, or nullptr if the memory is not host visible
+    inline void* GetMappedData() const { return _allocationInfo.pMappedData; }
+
+    /// @brief Makes device writes visible to the host for non-coherent memory
+    /// @details Call after the GPU work writing to the buffer completed and before reading GetMappedData().
+    void Invalidate() const;
+
+    /// @brief Makes host writes visible to the device for non-coherent memory
+    /// @details Call after writing through GetMappedData() and before the GPU reads the buffer.
+    void Flush() const;
+
 protected:
     // Protected Fields
 
@@ -74,6 +90,7 @@ private:
     VmaAllocator _allocator{VK_NULL_HANDLE};
     VmaAllocation _allocation{VK_NULL_HANDLE};  /// @brief VMA allocation handle
     VmaAllocationInfo _allocationInfo;
+    VkDeviceSize _size{0};
 
     // Private Methods
     
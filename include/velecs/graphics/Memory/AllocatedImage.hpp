@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "velecs/graphics/Sync/ImageState.hpp"
+
 #include <vulkan/vulkan_core.h>
 
 #include <vma/vk_mem_alloc.h>
@@ -31,6 +33,7 @@ public:
     VmaAllocation allocation{VK_NULL_HANDLE};
     VkExtent3D imageExtent{};
     VkFormat imageFormat{VK_FORMAT_UNDEFINED};
+    ImageState state{}; /// @brief Tracked layout and accesses, used to derive barriers.
 
     // Constructors and Destructors
 
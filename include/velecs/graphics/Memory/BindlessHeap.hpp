@@ -0,0 +1,156 @@
+/// @file    BindlessHeap.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 17:58:03
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @class BindlessHeap
+/// @brief Global descriptor set of large arrays indexed by shaders.
+///
+/// Holds one partially bound, update-after-bind array per resource type: combined
+/// image samplers at binding 0, storage images at binding 1 and storage buffers at
+/// binding 2. A resource is registered once and referenced by the returned 32-bit
+/// index, usually passed in a push constant or in per-draw data, so switching
+/// textures or buffers never rebinds a descriptor set. Registration is thread safe and
+/// allowed while the set is in use, since only unused array elements are written.
+class BindlessHeap {
+public:
+    // Enums
+
+    /// @enum ResourceType
+    /// @brief Array of the heap a resource lives in.
+    enum class ResourceType : uint8_t {
+        SampledImage,  /// @brief Combined image sampler, binding 0.
+        StorageImage,  /// @brief Storage image in VK_IMAGE_LAYOUT_GENERAL, binding 1.
+        StorageBuffer, /// @brief Storage buffer range, binding 2.
+    };
+
+    // Public Fields
+
+    static const uint32_t INVALID_INDEX;                   /// @brief Returned when an array is full.
+    static const uint32_t DEFAULT_SAMPLED_IMAGE_CAPACITY;
+    static const uint32_t DEFAULT_STORAGE_IMAGE_CAPACITY;
+    static const uint32_t DEFAULT_STORAGE_BUFFER_CAPACITY;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    BindlessHeap() = default;
+
+    /// @brief Default deconstructor.
+    ~BindlessHeap() = default;
+
+    BindlessHeap(const BindlessHeap&) = delete;
+    BindlessHeap& operator=(const BindlessHeap&) = delete;
+
+    // Public Methods
+
+    /// @brief Creates the descriptor pool, set layout and set of the heap.
+    /// @details Capacities are clamped to the device's update-after-bind limits. The device must have
+    /// the descriptor indexing features enabled, see RenderEngineConfig::bindless.
+    /// @param device Device owning the descriptors.
+    /// @param physicalDevice Physical device used to query the descriptor limits.
+    /// @param sampledImageCapacity Size of the combined image sampler array.
+    /// @param storageImageCapacity Size of the storage image array.
+    /// @param storageBufferCapacity Size of the storage buffer array.
+    /// @return True on success, false otherwise.
+    bool Init(
+        const VkDevice device,
+        const VkPhysicalDevice physicalDevice,
+        const uint32_t sampledImageCapacity = DEFAULT_SAMPLED_IMAGE_CAPACITY,
+        const uint32_t storageImageCapacity = DEFAULT_STORAGE_IMAGE_CAPACITY,
+        const uint32_t storageBufferCapacity = DEFAULT_STORAGE_BUFFER_CAPACITY
+    );
+
+    /// @brief Destroys the descriptor pool and set layout.
+    /// @details The GPU must no longer use the set.
+    void Cleanup();
+
+    /// @brief Registers a sampled image.
+    /// @param imageView View of the image.
+    /// @param sampler Sampler the shader reads the image with.
+    /// @param imageLayout Layout of the image whenever a shader reads it.
+    /// @return Index of the image in the array, or INVALID_INDEX if the array is full.
+    uint32_t RegisterSampledImage(
+        const VkImageView imageView,
+        const VkSampler sampler,
+        const VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    );
+
+    /// @brief Registers a storage image, accessed in VK_IMAGE_LAYOUT_GENERAL.
+    /// @param imageView View of the image.
+    /// @return Index of the image in the array, or INVALID_INDEX if the array is full.
+    uint32_t RegisterStorageImage(const VkImageView imageView);
+
+    /// @brief Registers a range of a storage buffer.
+    /// @param buffer Buffer created with VK_BUFFER_USAGE_STORAGE_BUFFER_BIT.
+    /// @param offset Start of the range.
+    /// @param range Size of the range.
+    /// @return Index of the buffer in the array, or INVALID_INDEX if the array is full.
+    uint32_t RegisterStorageBuffer(const VkBuffer buffer, const VkDeviceSize offset = 0, const VkDeviceSize range = VK_WHOLE_SIZE);
+
+    /// @brief Makes an index available to later registrations.
+    /// @details No submitted work may still read the index, see RenderEngine::ReleaseBindlessIndex().
+    /// @param type Array of the index.
+    /// @param index Index returned by a Register method.
+    void Free(const ResourceType type, const uint32_t index);
+
+    /// @brief Binds the heap.
+    /// @param cmd Command buffer to record into.
+    /// @param bindPoint Bind point of the pipeline reading the heap.
+    /// @param layout Layout of the pipeline, its set at setIndex must be GetDescriptorSetLayout().
+    /// @param setIndex Index of the set in the layout.
+    void Bind(const VkCommandBuffer cmd, const VkPipelineBindPoint bindPoint, const VkPipelineLayout layout, const uint32_t setIndex = 0) const;
+
+    /// @brief Gets the layout of the heap, for building pipeline layouts.
+    inline VkDescriptorSetLayout GetDescriptorSetLayout() const { return _descriptorSetLayout; }
+
+    /// @brief Gets the descriptor set of the heap.
+    inline VkDescriptorSet GetDescriptorSet() const { return _descriptorSet; }
+
+    /// @brief Gets the size of an array.
+    inline uint32_t GetCapacity(const ResourceType type) const { return _slots[static_cast<size_t>(type)].capacity; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    struct Slots {
+        uint32_t capacity{0};
+        uint32_t next{0};           /// @brief First index never handed out.
+        std::vector<uint32_t> free; /// @brief Freed indices, reused first.
+    };
+
+    VkDevice _device{VK_NULL_HANDLE};
+    VkDescriptorPool _pool{VK_NULL_HANDLE};
+    VkDescriptorSetLayout _descriptorSetLayout{VK_NULL_HANDLE};
+    VkDescriptorSet _descriptorSet{VK_NULL_HANDLE};
+
+    std::mutex _mutex; /// @brief Guards the slots and descriptor writes, which need external synchronization.
+    Slots _slots[3];   /// @brief Indexed by ResourceType.
+
+    // Private Methods
+
+    uint32_t AllocateSlot(const ResourceType type);
+    void WriteDescriptor(const ResourceType type, const uint32_t index, const VkDescriptorImageInfo* const imageInfo, const VkDescriptorBufferInfo* const bufferInfo);
+};
+
+} // namespace velecs::graphics
@@ -10,8 +10,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <deque>
 #include <functional>
+#include <utility>
 
 namespace velecs::graphics {
 /// @class DeletionQueue
@@ -36,6 +38,15 @@ public:
 
     void PushDeleter(std::function<void()>&& deleter);
 
+    /// @brief Queues a deleter to run once the GPU reached a timeline value.
+    /// @param deleter Function releasing the objects.
+    /// @param value Timeline value of the last GPU work using the objects, must not be lower than the previous one.
+    void PushDeleter(std::function<void()>&& deleter, const uint64_t value);
+
+    /// @brief Runs the deleters whose timeline value was reached, in the order they were pushed.
+    /// @param completedValue Timeline value the GPU reached.
+    void Retire(const uint64_t completedValue);
+
     void Flush();
 
 protected:
@@ -47,6 +58,7 @@ private:
     // Private Fields
 
     std::deque<std::function<void()>> _deleters;
+    std::deque<std::pair<uint64_t, std::function<void()>>> _pendingDeleters; /// @brief Deleters waiting on a timeline value.
 
     // Private Methods
 };
@@ -0,0 +1,117 @@
+/// @file    IndirectDrawBuffers.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:31:08
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Memory/AllocatedBuffer.hpp"
+#include "velecs/graphics/ObjectData.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <vma/vk_mem_alloc.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace velecs::graphics {
+
+/// @class IndirectDrawBuffers
+/// @brief Host visible buffers feeding vkCmdDrawIndexedIndirectCount for one frame in flight.
+///
+/// Holds the ObjectData of every draw, one VkDrawIndexedIndirectCommand per draw
+/// and one draw count per bucket. Buffers grow to the largest frame seen and are
+/// only recreated while the frame slot is idle.
+class IndirectDrawBuffers {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const size_t MIN_DRAW_CAPACITY;   /// @brief Draws allocated up front, capacity doubles from there.
+    static const size_t MIN_BUCKET_CAPACITY; /// @brief Buckets allocated up front, capacity doubles from there.
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    IndirectDrawBuffers() = default;
+
+    /// @brief Default deconstructor.
+    ~IndirectDrawBuffers() = default;
+
+    IndirectDrawBuffers(const IndirectDrawBuffers&) = delete;
+    IndirectDrawBuffers& operator=(const IndirectDrawBuffers&) = delete;
+    IndirectDrawBuffers(IndirectDrawBuffers&&) = default;
+    IndirectDrawBuffers& operator=(IndirectDrawBuffers&&) = default;
+
+    // Public Methods
+
+    /// @brief Grows the buffers to hold at least the given number of draws and buckets.
+    /// @details The GPU must no longer use the buffers.
+    /// @param device Device used to query the object buffer address.
+    /// @param allocator Allocator creating the buffers.
+    /// @param drawCount Number of draws of the frame.
+    /// @param bucketCount Number of indirect calls of the frame.
+    /// @return True on success, false otherwise.
+    bool Reserve(const VkDevice device, const VmaAllocator allocator, const size_t drawCount, const size_t bucketCount);
+
+    /// @brief Makes host writes visible to the device for non-coherent memory.
+    void Flush() const;
+
+    /// @brief Destroys the buffers.
+    void Cleanup();
+
+    /// @brief Gets the mapped per-draw data, indexed by draw.
+    inline ObjectData* GetObjects() const { return static_cast<ObjectData*>(_objectBuffer->GetMappedData()); }
+
+    /// @brief Gets the mapped indirect commands, indexed by draw.
+    inline VkDrawIndexedIndirectCommand* GetCommands() const { return static_cast<VkDrawIndexedIndirectCommand*>(_commandBuffer->GetMappedData()); }
+
+    /// @brief Gets the mapped draw counts, indexed by bucket.
+    inline uint32_t* GetCounts() const { return static_cast<uint32_t*>(_countBuffer->GetMappedData()); }
+
+    /// @brief Gets the buffer of indirect commands.
+    inline VkBuffer GetCommandBuffer() const { return _commandBuffer ? _commandBuffer->buffer : VK_NULL_HANDLE; }
+
+    /// @brief Gets the buffer of draw counts.
+    inline VkBuffer GetCountBuffer() const { return _countBuffer ? _countBuffer->buffer : VK_NULL_HANDLE; }
+
+    /// @brief Gets the device address of the per-draw data.
+    inline VkDeviceAddress GetObjectBufferAddress() const { return _objectBufferAddress; }
+
+    /// @brief Gets the device address of the indirect commands, written by GPU culling.
+    inline VkDeviceAddress GetCommandBufferAddress() const { return _commandBufferAddress; }
+
+    /// @brief Gets the device address of the draw counts, written by GPU culling.
+    inline VkDeviceAddress GetCountBufferAddress() const { return _countBufferAddress; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::unique_ptr<AllocatedBuffer> _objectBuffer;  /// @brief ObjectData per draw.
+    std::unique_ptr<AllocatedBuffer> _commandBuffer; /// @brief VkDrawIndexedIndirectCommand per draw.
+    std::unique_ptr<AllocatedBuffer> _countBuffer;   /// @brief Draw count per bucket.
+    VkDeviceAddress _objectBufferAddress{0};
+    VkDeviceAddress _commandBufferAddress{0};
+    VkDeviceAddress _countBufferAddress{0};
+
+    size_t _drawCapacity{0};
+    size_t _bucketCapacity{0};
+
+    // Private Methods
+
+    static VkDeviceAddress GetBufferAddress(const VkDevice device, const VkBuffer buffer);
+};
+
+} // namespace velecs::graphics
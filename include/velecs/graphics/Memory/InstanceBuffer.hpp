@@ -0,0 +1,89 @@
+/// @file    InstanceBuffer.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 16:47:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Memory/AllocatedBuffer.hpp"
+#include "velecs/graphics/ObjectData.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <vma/vk_mem_alloc.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace velecs::graphics {
+
+/// @class InstanceBuffer
+/// @brief Host visible ObjectData array of instanced draws for one frame in flight.
+///
+/// Instanced draws set firstInstance to the offset of their first object, so
+/// shaders find each instance's data at gl_InstanceIndex. The buffer grows to the
+/// largest frame seen and is only recreated while the frame slot is idle.
+class InstanceBuffer {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const size_t MIN_INSTANCE_CAPACITY; /// @brief Instances allocated up front, capacity doubles from there.
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    InstanceBuffer() = default;
+
+    /// @brief Default deconstructor.
+    ~InstanceBuffer() = default;
+
+    InstanceBuffer(const InstanceBuffer&) = delete;
+    InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+    InstanceBuffer(InstanceBuffer&&) = default;
+    InstanceBuffer& operator=(InstanceBuffer&&) = default;
+
+    // Public Methods
+
+    /// @brief Grows the buffer to hold at least the given number of instances.
+    /// @details The GPU must no longer use the buffer.
+    /// @param device Device used to query the buffer address.
+    /// @param allocator Allocator creating the buffer.
+    /// @param instanceCount Number of instances of the frame.
+    /// @return True on success, false otherwise.
+    bool Reserve(const VkDevice device, const VmaAllocator allocator, const size_t instanceCount);
+
+    /// @brief Makes host writes visible to the device for non-coherent memory.
+    void Flush() const;
+
+    /// @brief Destroys the buffer.
+    void Cleanup();
+
+    /// @brief Gets the mapped per-instance data.
+    inline ObjectData* GetInstances() const { return static_cast<ObjectData*>(_buffer->GetMappedData()); }
+
+    /// @brief Gets the device address of the per-instance data.
+    inline VkDeviceAddress GetBufferAddress() const { return _bufferAddress; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::unique_ptr<AllocatedBuffer> _buffer; /// @brief ObjectData per instance.
+    VkDeviceAddress _bufferAddress{0};
+    size_t _capacity{0};
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,156 @@
+/// @file    UniformRingAllocator.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 17:22:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Memory/AllocatedBuffer.hpp"
+#include "velecs/graphics/Memory/DescriptorAllocator.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <vma/vk_mem_alloc.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace velecs::graphics {
+
+/// @class UniformRingAllocator
+/// @brief Sub-allocates per-frame uniform blocks from one persistently mapped buffer.
+///
+/// The buffer is split into one region per frame in flight. BeginFrame() rewinds
+/// the region of the frame being recorded, which the GPU finished reading since its
+/// frame slot was waited on, so writing a block never touches data still in flight.
+/// Blocks are read through a single UNIFORM_BUFFER_DYNAMIC descriptor set shared by
+/// every block: bind it with the dynamic offset returned by Allocate() or Write().
+/// Programs reading the blocks declare their set with RasterizationShaderProgram::SetUniformRing(),
+/// so their pipeline layout uses the ring's layout rather than the reflected one.
+/// Allocations are lock free and can be made from any thread while recording.
+class UniformRingAllocator {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    UniformRingAllocator() = default;
+
+    /// @brief Default deconstructor.
+    ~UniformRingAllocator() = default;
+
+    UniformRingAllocator(const UniformRingAllocator&) = delete;
+    UniformRingAllocator& operator=(const UniformRingAllocator&) = delete;
+
+    // Public Methods
+
+    /// @brief Creates the buffer, its descriptor set layout and its descriptor set.
+    /// @param device Device owning the buffer.
+    /// @param physicalDevice Physical device used to query the offset alignment.
+    /// @param allocator Allocator creating the buffer.
+    /// @param descriptorAllocator Allocator of the shared descriptor set, needs one UNIFORM_BUFFER_DYNAMIC descriptor.
+    /// @param frameCount Number of frames in flight.
+    /// @param bytesPerFrame Size of the region of each frame.
+    /// @param blockSize Largest block, the range of the shared descriptor.
+    /// @param stages Shader stages reading the blocks.
+    /// @return True on success, false otherwise.
+    bool Init(
+        const VkDevice device,
+        const VkPhysicalDevice physicalDevice,
+        const VmaAllocator allocator,
+        DescriptorAllocator& descriptorAllocator,
+        const uint32_t frameCount,
+        const VkDeviceSize bytesPerFrame,
+        const VkDeviceSize blockSize,
+        const VkShaderStageFlags stages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT
+    );
+
+    /// @brief Destroys the buffer and the descriptor set layout.
+    /// @details The GPU must no longer use them, the descriptor set is freed with its pool.
+    void Cleanup();
+
+    /// @brief Rewinds the region of a frame.
+    /// @details The GPU must be done with the last frame that used the region.
+    /// @param frameIndex Index of the frame slot being recorded.
+    void BeginFrame(const uint32_t frameIndex);
+
+    /// @brief Reserves an aligned block in the region of the current frame.
+    /// @param size Size of the block, at most the block size given to Init().
+    /// @param dynamicOffset Set to the offset to bind the shared descriptor set with.
+    /// @return Mapped memory of the block, or nullptr if the region is full or the block too large.
+    void* Allocate(const VkDeviceSize size, uint32_t& dynamicOffset);
+
+    /// @brief Copies a uniform block into the region of the current frame.
+    /// @param data Block to copy, a std140 compatible struct.
+    /// @param dynamicOffset Set to the offset to bind the shared descriptor set with.
+    /// @return True on success, false if the region is full.
+    template<typename T>
+    inline bool Write(const T& data, uint32_t& dynamicOffset)
+    {
+        void* const mapped = Allocate(sizeof(T), dynamicOffset);
+        if (mapped == nullptr) return false;
+
+        std::memcpy(mapped, &data, sizeof(T));
+        return true;
+    }
+
+    /// @brief Makes the blocks written this frame visible to the device for non-coherent memory.
+    /// @details Call once recording is done, before the frame is submitted.
+    void Flush() const;
+
+    /// @brief Binds the shared descriptor set at a block.
+    /// @param cmd Command buffer to record into.
+    /// @param bindPoint Bind point of the pipeline reading the block.
+    /// @param layout Layout of the pipeline, its set at setIndex must be compatible with GetDescriptorSetLayout().
+    /// @param setIndex Index of the set in the layout.
+    /// @param dynamicOffset Offset returned by Allocate() or Write().
+    void Bind(
+        const VkCommandBuffer cmd,
+        const VkPipelineBindPoint bindPoint,
+        const VkPipelineLayout layout,
+        const uint32_t setIndex,
+        const uint32_t dynamicOffset
+    ) const;
+
+    /// @brief Gets the layout of the shared descriptor set, for building pipeline layouts.
+    inline VkDescriptorSetLayout GetDescriptorSetLayout() const { return _descriptorSetLayout; }
+
+    /// @brief Gets the shared descriptor set.
+    inline VkDescriptorSet GetDescriptorSet() const { return _descriptorSet; }
+
+    /// @brief Gets the number of bytes allocated in the region of the current frame.
+    inline VkDeviceSize GetUsedBytes() const { return _head.load(std::memory_order_relaxed); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    VkDevice _device{VK_NULL_HANDLE};
+    std::unique_ptr<AllocatedBuffer> _buffer;
+    VkDescriptorSetLayout _descriptorSetLayout{VK_NULL_HANDLE};
+    VkDescriptorSet _descriptorSet{VK_NULL_HANDLE};
+
+    VkDeviceSize _alignment{1};         /// @brief minUniformBufferOffsetAlignment of the device.
+    VkDeviceSize _bytesPerFrame{0};     /// @brief Size of each frame's region, a multiple of the alignment.
+    VkDeviceSize _blockSize{0};         /// @brief Range of the shared descriptor.
+    VkDeviceSize _regionOffset{0};      /// @brief Start of the current frame's region in the buffer.
+    std::atomic<VkDeviceSize> _head{0}; /// @brief Next free byte in the current frame's region.
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
@@ -10,23 +10,45 @@
 
 #pragma once
 
+#include "velecs/graphics/Memory/UploadTicket.hpp"
+#include "velecs/graphics/Memory/AllocatedBuffer.hpp"
+#include "velecs/graphics/Memory/AllocatedImage.hpp"
+#include "velecs/graphics/Sync/ImageUsage.hpp"
+
 #include <vulkan/vulkan_core.h>
 
+#include <vma/vk_mem_alloc.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 namespace velecs::graphics {
 
 /// @class UploadContext
-/// @brief Brief description.
+/// @brief Copies data into device local buffers and images from a transfer queue.
+///
+/// Uploads are staged into host visible memory right away and recorded into the
+/// open batch, Submit() sends the whole batch in one submission that signals the
+/// next value of a timeline semaphore. Staging memory is recycled once its batch
+/// completed. Uploads can be queued from any thread, Submit() and RecordAcquires()
+/// must be called from the render thread.
 ///
-/// Rest of description.
+/// When the transfer queue belongs to another family than the graphics queue, every
+/// resource is released at the end of its batch and acquired by the graphics queue
+/// in RecordAcquires(), once the batch completed. Destination resources must stay
+/// alive until their ticket IsReady().
 class UploadContext {
 public:
     // Enums
 
     // Public Fields
 
-    VkFence _uploadFence{VK_NULL_HANDLE};
-	VkCommandPool _commandPool{VK_NULL_HANDLE};
-	VkCommandBuffer _commandBuffer{VK_NULL_HANDLE};
+    static const VkDeviceSize STAGING_PAGE_SIZE; /// @brief Size of a staging buffer, larger uploads get a dedicated one.
 
     // Constructors and Destructors
 
@@ -36,8 +58,95 @@ public:
     /// @brief Default deconstructor.
     ~UploadContext() = default;
 
+    UploadContext(const UploadContext&) = delete;
+    UploadContext& operator=(const UploadContext&) = delete;
+
     // Public Methods
 
+    /// @brief Creates the command pool and timeline semaphore of the uploads.
+    /// @param device Device owning the destination resources.
+    /// @param allocator Allocator creating the staging buffers.
+    /// @param queue Queue the copies are submitted to.
+    /// @param queueFamily Queue family of the queue.
+    /// @param graphicsQueueFamily Queue family using the uploaded resources.
+    /// @return True on success, false otherwise.
+    bool Init(
+        const VkDevice device,
+        const VmaAllocator allocator,
+        const VkQueue queue,
+        const uint32_t queueFamily,
+        const uint32_t graphicsQueueFamily
+    );
+
+    /// @brief Destroys every Vulkan object of the context.
+    /// @details The GPU must no longer use them.
+    void Cleanup();
+
+    /// @brief Queues a copy of host data into a buffer.
+    /// @param destination Buffer created with VK_BUFFER_USAGE_TRANSFER_DST_BIT.
+    /// @param data Data to copy, staged before returning so it can be freed right away.
+    /// @param size Number of bytes to copy.
+    /// @param dstOffset Offset in the destination buffer.
+    /// @return Ticket of the upload, invalid if staging memory could not be allocated.
+    UploadTicket UploadBuffer(
+        const AllocatedBuffer& destination,
+        const void* const data,
+        const VkDeviceSize size,
+        const VkDeviceSize dstOffset = 0
+    );
+
+    /// @brief Queues a copy of host data into the first mip level of an image.
+    /// @param destination Image created with VK_IMAGE_USAGE_TRANSFER_DST_BIT, its previous contents are discarded.
+    /// @param data Tightly packed texels, staged before returning so they can be freed right away.
+    /// @param size Number of bytes to copy.
+    /// @param finalUsage Usage the image is left ready for.
+    /// @return Ticket of the upload, invalid if staging memory could not be allocated.
+    UploadTicket UploadImage(
+        AllocatedImage& destination,
+        const void* const data,
+        const VkDeviceSize size,
+        const ImageUsage finalUsage = ImageUsage::FragmentSampledRead
+    );
+
+    /// @brief Records custom transfer commands into the open batch.
+    /// @param function Function recording the commands, called with the batch command buffer.
+    /// @return Ticket of the batch.
+    UploadTicket Record(std::function<void(VkCommandBuffer)>&& function);
+
+    /// @brief Submits the open batch.
+    /// @details A failed batch is discarded, its uploads never happen and its tickets report IsFailed().
+    /// @return Ticket of the submitted batch, invalid if nothing was queued or the submission failed.
+    UploadTicket Submit();
+
+    /// @brief Checks if the copies of a ticket finished on the GPU.
+    bool IsComplete(const UploadTicket ticket) const;
+
+    /// @brief Checks if the graphics queue can use the resources of a ticket.
+    /// @details Lags behind IsComplete() by a frame when the transfer queue is in another family.
+    bool IsReady(const UploadTicket ticket) const;
+
+    /// @brief Checks if the batch of a ticket was discarded.
+    /// @details Such a ticket never completes, its resources must be uploaded again.
+    bool IsFailed(const UploadTicket ticket) const;
+
+    /// @brief Blocks the calling thread until the copies of a ticket finished on the GPU.
+    /// @details A ticket of the open batch only completes after the next Submit().
+    /// @param ticket Ticket to wait on.
+    /// @param timeout Timeout in nanoseconds.
+    /// @return True if the ticket completed, false on timeout or error.
+    bool Wait(const UploadTicket ticket, const uint64_t timeout = UINT64_MAX) const;
+
+    /// @brief Recycles completed batches and records the graphics side of their ownership transfers.
+    /// @param cmd Graphics command buffer, submitted after this call.
+    /// @return Timeline value the submission of cmd must wait on, 0 if none.
+    uint64_t RecordAcquires(const VkCommandBuffer cmd);
+
+    /// @brief Gets the timeline semaphore signaled by the upload batches.
+    inline VkSemaphore GetTimelineSemaphore() const { return _timelineSemaphore; }
+
+    /// @brief Checks if uploads run on a queue of another family than the graphics queue.
+    inline bool IsTransferQueueSeparate() const { return _queueFamily != _graphicsQueueFamily; }
+
 protected:
     // Protected Fields
 
@@ -46,7 +155,46 @@ protected:
 private:
     // Private Fields
 
+    struct StagingPage {
+        std::unique_ptr<AllocatedBuffer> buffer;
+        VkDeviceSize offset{0}; /// @brief Start of the free space of the page.
+    };
+
+    struct Batch {
+        VkCommandBuffer cmd{VK_NULL_HANDLE};
+        uint64_t value{0};
+        std::vector<StagingPage> pages;
+        std::vector<VkBufferMemoryBarrier2> bufferAcquires;
+        std::vector<VkImageMemoryBarrier2> imageAcquires;
+        std::vector<std::pair<ImageState*, ImageUsage>> acquiredImages; /// @brief Tracked states updated once acquired.
+    };
+
+    VkDevice _device{VK_NULL_HANDLE};
+    VmaAllocator _allocator{VK_NULL_HANDLE};
+    VkQueue _queue{VK_NULL_HANDLE};
+    uint32_t _queueFamily{0};
+    uint32_t _graphicsQueueFamily{0};
+
+    VkCommandPool _commandPool{VK_NULL_HANDLE};
+    VkSemaphore _timelineSemaphore{VK_NULL_HANDLE};
+
+    mutable std::mutex _mutex;                  /// @brief Guards the batches, the command pool and the staging pages.
+    std::unique_ptr<Batch> _openBatch;          /// @brief Batch receiving new uploads.
+    std::deque<std::unique_ptr<Batch>> _submittedBatches;
+    std::vector<VkCommandBuffer> _freeCommandBuffers;
+    std::vector<StagingPage> _freePages;
+
+    uint64_t _nextValue{1};     /// @brief Timeline value of the open batch.
+    uint64_t _acquiredValue{0}; /// @brief Highest value whose resources the graphics queue acquired.
+    std::vector<uint64_t> _failedValues; /// @brief Values of the discarded batches, in increasing order.
+
     // Private Methods
+
+    Batch* GetOpenBatch();
+    void DiscardOpenBatch();
+    bool AllocateStaging(Batch& batch, const VkDeviceSize size, VkBuffer& buffer, VkDeviceSize& offset, void*& mapped);
+    uint64_t GetCompletedValue() const;
+    bool IsFailedValue(const uint64_t value) const;
 };
 
 } // namespace velecs::graphics
@@ -0,0 +1,30 @@
+/// @file    UploadTicket.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:02:31
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @struct UploadTicket
+/// @brief Handle to an upload queued on an UploadContext.
+///
+/// Holds the timeline value signaled once the batch containing the upload finished
+/// on the GPU. Later batches have larger values, so a ticket also covers every
+/// upload queued before it.
+struct UploadTicket {
+    uint64_t value{0}; /// @brief Timeline value of the batch, 0 for no upload.
+
+    /// @brief Checks if the ticket refers to an upload.
+    inline bool IsValid() const { return value != 0; }
+};
+
+} // namespace velecs::graphics
@@ -14,6 +14,10 @@
 
 #include "velecs/graphics/Vertex.hpp"
 #include "velecs/graphics/Memory/AllocatedBuffer.hpp"
+#include "velecs/graphics/Memory/DeletionQueue.hpp"
+#include "velecs/graphics/Memory/UploadContext.hpp"
+#include "velecs/graphics/Memory/UniformRingAllocator.hpp"
+#include "velecs/graphics/Culling/BoundingVolume.hpp"
 
 #include <velecs/common/Paths.hpp>
 
@@ -132,14 +136,41 @@ public:
     /// @return True if mesh uses indexed rendering
     inline bool IsIndexed() const { return !indices.empty(); }
 
-    void NewUpload(const VkDevice device, const VmaAllocator allocator)
+    /// @brief Creates new GPU buffers and queues the copy of the mesh data into them.
+    /// @param device Vulkan device handle
+    /// @param allocator VMA allocator
+    /// @param uploadContext Upload context the copies are queued on
+    /// @param retiredQueue Deletion queue receiving the previous buffers
+    /// @param retireValue Timeline value after which the GPU no longer uses the previous buffers
+    /// @return True if the copies were queued, false on error
+    /// @details Marks the mesh clean. The buffers must not be drawn before GetUploadTicket() is ready.
+    bool NewUpload(
+        const VkDevice device,
+        const VmaAllocator allocator,
+        UploadContext& uploadContext,
+        DeletionQueue& retiredQueue,
+        const uint64_t retireValue
+    )
     {
         const size_t vertexBufferSize = vertices.size() * sizeof(Vertex);
         const size_t indexBufferSize = indices.size() * sizeof(uint32_t);
+        if (vertexBufferSize == 0) return false;
+
+        // In flight frames may still read the previous buffers
+        if (vertexBuffer || indexBuffer)
+        {
+            std::shared_ptr<AllocatedBuffer> oldVertexBuffer = std::move(vertexBuffer);
+            std::shared_ptr<AllocatedBuffer> oldIndexBuffer = std::move(indexBuffer);
+            retiredQueue.PushDeleter([oldVertexBuffer, oldIndexBuffer]() mutable {
+                oldVertexBuffer.reset();
+                oldIndexBuffer.reset();
+            }, retireValue);
+        }
 
         //create vertex buffer
         vertexBuffer = AllocatedBuffer::TryCreateBuffer(allocator, vertexBufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
             VMA_MEMORY_USAGE_GPU_ONLY);
+        if (!vertexBuffer) return false;
 
         //find the adress of the vertex buffer
         VkBufferDeviceAddressInfo deviceAddressInfo{};
@@ -147,11 +178,34 @@ public:
         deviceAddressInfo.buffer = vertexBuffer->buffer;
         vertexBufferAddress = vkGetBufferDeviceAddress(device, &deviceAddressInfo);
 
-        //create index buffer
-        indexBuffer = AllocatedBuffer::TryCreateBuffer(allocator, indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-            VMA_MEMORY_USAGE_GPU_ONLY);
+        _uploadTicket = uploadContext.UploadBuffer(*vertexBuffer, vertices.data(), vertexBufferSize);
+        if (!_uploadTicket.IsValid()) return false;
+
+        if (indexBufferSize > 0)
+        {
+            //create index buffer
+            indexBuffer = AllocatedBuffer::TryCreateBuffer(allocator, indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                VMA_MEMORY_USAGE_GPU_ONLY);
+            if (!indexBuffer) return false;
+
+            // Both copies land in the same batch, so the later ticket covers the vertices too
+            _uploadTicket = uploadContext.UploadBuffer(*indexBuffer, indices.data(), indexBufferSize);
+            if (!_uploadTicket.IsValid()) return false;
+        }
+
+        _bounds = ComputeBounds();
+
+        MarkClean();
+        return true;
     }
 
+    /// @brief Gets the local space bounds of the vertices, computed by the last NewUpload().
+    inline const BoundingVolume& GetBounds() const { return _bounds; }
+
+    /// @brief Gets the ticket of the last upload queued by NewUpload().
+    /// @return The upload ticket, invalid if the mesh was never uploaded.
+    inline UploadTicket GetUploadTicket() const { return _uploadTicket; }
+
     // MeshBase interface implementation
     void UploadImmediately(
         VkDevice device,
@@ -161,74 +215,21 @@ public:
 
     void Upload(VkDevice device, VmaAllocator allocator) override;
 
+    /// @brief Writes this frame's model uniforms into the uniform ring.
+    /// @details Costs a copy into mapped memory. Bind the ring's descriptor set at GetModelUniformsOffset()
+    /// to read them, the block stays valid until the frame slot is recorded again.
+    /// @param uniformRing Ring of the render engine, see RenderEngine::GetUniformRing().
+    /// @param modelUniforms Block to copy, at most the ring's block size.
+    /// @return True on success, false if the ring's region for this frame is full.
     template<typename ModelUniforms>
-    void UploadModelUniformsImmediate(
-        VkDevice device,
-        VmaAllocator allocator,
-        VkDescriptorPool descriptorPool,
-        VkDescriptorSetLayout descriptorSetLayout,
-        const ModelUniforms& modelUniforms,
-        std::function<void(std::function<void(VkCommandBuffer)>)> immediateSubmit
-    )
+    inline bool WriteModelUniforms(UniformRingAllocator& uniformRing, const ModelUniforms& modelUniforms)
     {
-        // Create the uniform buffer using VMA
-        modelUniformsBuffer = AllocatedBuffer::CreateImmediately(
-            allocator,
-            &modelUniforms,
-            sizeof(ModelUniforms),
-            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-            immediateSubmit
-        );
-
-        if (_descriptorSet == VK_NULL_HANDLE)
-        {
-            // Allocate descriptor set from the pool
-            VkDescriptorSetAllocateInfo allocInfo{};
-            allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-            allocInfo.descriptorPool = descriptorPool;
-            allocInfo.descriptorSetCount = 1;
-            allocInfo.pSetLayouts = &descriptorSetLayout;
-            
-            VkResult result = vkAllocateDescriptorSets(device, &allocInfo, &_descriptorSet);
-            if (result != VK_SUCCESS) {
-                std::ostringstream oss;
-                oss << "Failed to allocate descriptor set. VkResult: " << result;
-                switch (result) {
-                    case VK_ERROR_FRAGMENTED_POOL:
-                        oss << " (VK_ERROR_FRAGMENTED_POOL)";
-                        break;
-                    case VK_ERROR_OUT_OF_POOL_MEMORY:
-                        oss << " (VK_ERROR_OUT_OF_POOL_MEMORY)";
-                        break;
-                    case VK_ERROR_OUT_OF_HOST_MEMORY:
-                        oss << " (VK_ERROR_OUT_OF_HOST_MEMORY)";
-                        break;
-                    case VK_ERROR_OUT_OF_DEVICE_MEMORY:
-                        oss << " (VK_ERROR_OUT_OF_DEVICE_MEMORY)";
-                        break;
-                }
-                throw std::runtime_error(oss.str());
-            }
-        }
-        
-        // Update the descriptor set to point to our uniform buffer
-        VkDescriptorBufferInfo bufferInfo{};
-        bufferInfo.buffer = modelUniformsBuffer->GetBuffer();
-        bufferInfo.offset = 0;
-        bufferInfo.range = sizeof(ModelUniforms);
-        
-        VkWriteDescriptorSet descriptorWrite{};
-        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrite.dstSet = _descriptorSet;
-        descriptorWrite.dstBinding = 0;  // matches binding = 0 in shader
-        descriptorWrite.dstArrayElement = 0;
-        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        descriptorWrite.descriptorCount = 1;
-        descriptorWrite.pBufferInfo = &bufferInfo;
-        
-        vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
+        return uniformRing.Write(modelUniforms, _modelUniformsOffset);
     }
 
+    /// @brief Gets the dynamic offset of the block written by the last WriteModelUniforms().
+    inline uint32_t GetModelUniformsOffset() const { return _modelUniformsOffset; }
+
     void Draw(VkCommandBuffer cmd, VkPipelineLayout pipelineLayout) override;
 
     VkPipelineVertexInputStateCreateInfo GetVertexInputInfo() const override;
@@ -239,6 +240,14 @@ public:
     /// @return Number of indices (0 for non-indexed meshes)
     /// @details Useful for debugging and buffer size calculations.
     inline size_t GetIndexCount() const { return indices.size(); }
+
+    /// @brief Gets the GPU index buffer.
+    /// @return The index buffer, or VK_NULL_HANDLE if the mesh was not uploaded.
+    inline VkBuffer GetIndexBuffer() const { return indexBuffer ? indexBuffer->buffer : VK_NULL_HANDLE; }
+
+    /// @brief Gets the device address of the GPU vertex buffer, read by shaders through buffer device address.
+    /// @return The vertex buffer address, or 0 if the mesh was not uploaded.
+    inline VkDeviceAddress GetVertexBufferAddress() const { return vertexBuffer ? vertexBufferAddress : 0; }
     
     /// @brief Gets the number of primitives (triangles, lines, points) in this mesh.
     /// @return Number of primitives that will be rendered
@@ -262,8 +271,10 @@ protected:
     /// @brief GPU index buffer.
     std::unique_ptr<AllocatedBuffer> indexBuffer{nullptr};
 
-    std::unique_ptr<AllocatedBuffer> modelUniformsBuffer{nullptr};
-    VkDescriptorSet _descriptorSet{VK_NULL_HANDLE};
+    uint32_t _modelUniformsOffset{0}; /// @brief Dynamic offset of the model uniforms in the uniform ring.
+
+    UploadTicket _uploadTicket{}; /// @brief Ticket of the copies into the GPU buffers.
+    BoundingVolume _bounds{};     /// @brief Bounds of the uploaded vertices, used for culling.
 
     // Protected Methods
 
@@ -284,6 +295,9 @@ private:
                      const std::vector<T>& data, VkBufferUsageFlags usage,
                      AllocatedBuffer& buffer);
     
+    /// @brief Computes the bounding box of the vertices and the sphere around it.
+    BoundingVolume ComputeBounds() const;
+
     static std::unique_ptr<Assimp::Importer> AssimpLoadScene(const std::filesystem::path& filePath);
 
     void LoadFromAssimpMesh(const aiMesh* assimpMesh);
@@ -0,0 +1,50 @@
+/// @file    ObjectData.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:31:08
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <velecs/math/Mat4.hpp>
+using velecs::math::Mat4;
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @struct ObjectData
+/// @brief Per-draw data of indirect draws, read by shaders through buffer device address.
+///
+/// Laid out to match the equivalent std430 struct, shaders index the array with
+/// gl_InstanceIndex. The bounds and bucket fields are only read by the culling shader.
+struct ObjectData {
+    Mat4 worldMatrix;
+    float boundsCenter[3];        /// @brief Local space center of the mesh bounds.
+    float boundsRadius;           /// @brief Local space radius of the mesh bounding sphere.
+    float boundsExtents[3];       /// @brief Local space half size of the mesh bounding box.
+    uint32_t indexCount;          /// @brief Index count of the draw's command.
+    VkDeviceAddress vertexBuffer;
+    uint32_t bucket;              /// @brief Index of the draw's indirect call, selects its count.
+    uint32_t bucketFirstDraw;     /// @brief First command of the draw's indirect call.
+    uint32_t bindlessIndex;       /// @brief Bindless heap index of the material's resources.
+    uint32_t padding[3];          /// @brief The std430 array stride is a multiple of the matrix alignment.
+
+    static_assert(sizeof(Mat4) == 64);
+};
+
+static_assert(sizeof(ObjectData) == 128);
+
+/// @struct IndirectPushConstant
+/// @brief Push constant of programs drawn through the indirect path.
+struct IndirectPushConstant {
+    VkDeviceAddress objectBuffer; /// @brief Device address of the frame's ObjectData array.
+};
+
+} // namespace velecs::graphics
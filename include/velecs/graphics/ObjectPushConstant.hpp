@@ -15,6 +15,8 @@ using velecs::math::Mat4;
 
 #include <vulkan/vulkan_core.h>
 
+#include <cstdint>
+
 namespace velecs::graphics {
 
 /// @struct ObjectPushConstant
@@ -24,6 +26,7 @@ namespace velecs::graphics {
 struct ObjectPushConstant {
     Mat4 worldMatrix;
     VkDeviceAddress vertexBuffer;
+    uint32_t bindlessIndex; /// @brief Bindless heap index of the material's resources.
 };
 
 } // namespace velecs::graphics
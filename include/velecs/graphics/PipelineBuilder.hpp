@@ -37,6 +37,7 @@ public:
     VkPipelineMultisampleStateCreateInfo _multisampling; /// @brief Multisampling state parameters.
     VkPipelineLayout _pipelineLayout{VK_NULL_HANDLE}; /// @brief The layout of the pipeline, describing shader stages and more.
     VkPipelineDepthStencilStateCreateInfo _depthStencil;
+    VkPipelineCache _pipelineCache{VK_NULL_HANDLE}; /// @brief Optional cache the pipeline is looked up in.
 
     // Constructors and Destructors
     
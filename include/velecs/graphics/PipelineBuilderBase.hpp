@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include "velecs/graphics/PipelineCache.hpp"
+
 #include <vulkan/vulkan_core.h>
 
 namespace velecs::graphics {
@@ -63,6 +65,15 @@ public:
         return derived();
     }
 
+    /// @brief Sets the cache the pipeline is looked up in and its creation feedback reported to.
+    /// @param pipelineCache Engine-wide cache, nullptr to create the pipeline without one
+    /// @return Reference to this builder for method chaining
+    Derived& SetPipelineCache(PipelineCache* const pipelineCache)
+    {
+        _pipelineCache = pipelineCache;
+        return derived();
+    }
+
     /// @brief Creates and returns the configured Vulkan pipeline.
     /// @return Handle to the created Vulkan pipeline
     /// @throws std::runtime_error if validation fails or pipeline creation fails
@@ -78,6 +89,7 @@ protected:
 
     VkDevice _device{VK_NULL_HANDLE};                 /// @brief Vulkan device handle for pipeline creation
     VkPipelineLayout _pipelineLayout{VK_NULL_HANDLE}; /// @brief Pipeline layout describing resource bindings and push constants
+    PipelineCache* _pipelineCache{nullptr};           /// @brief Optional cache, not owned
 
     // Protected Methods
 
@@ -88,6 +100,18 @@ protected:
     ///          type-specific pipeline creation logic. Assumes valid state.
     virtual VkPipeline CreatePipeline() = 0;
 
+    /// @brief Gets the cache handle passed to vkCreate*Pipelines.
+    VkPipelineCache GetPipelineCacheHandle() const
+    {
+        return _pipelineCache != nullptr ? _pipelineCache->GetHandle() : VK_NULL_HANDLE;
+    }
+
+    /// @brief Reports the creation feedback of a created pipeline to the cache, if any.
+    void RecordFeedback(const VkPipelineCreationFeedback& feedback) const
+    {
+        if (_pipelineCache != nullptr) _pipelineCache->RecordFeedback(feedback);
+    }
+
 private:
     // Private Fields
 
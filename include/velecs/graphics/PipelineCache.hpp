@@ -0,0 +1,121 @@
+/// @file    PipelineCache.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 18:12:37
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Threading/WorkerPool.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @struct PipelineCacheStats
+/// @brief Creation feedback of the pipelines created through a PipelineCache.
+struct PipelineCacheStats {
+    uint32_t pipelineCount{0}; /// @brief Pipelines created with valid feedback.
+    uint32_t cacheHitCount{0}; /// @brief Pipelines found in the cache without compiling.
+    double milliseconds{0.0};  /// @brief Total creation time of the pipelines.
+};
+
+/// @class PipelineCache
+/// @brief Engine-wide VkPipelineCache persisted to disk between runs.
+///
+/// The cache file is only loaded if its header matches the vendor, device and cache
+/// UUID of the physical device, drivers may reject or crash on a foreign blob.
+/// Pipeline builders given the cache report the creation feedback of every pipeline
+/// through RecordFeedback(), which can be called from any thread.
+class PipelineCache {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const std::chrono::seconds AUTOSAVE_INTERVAL; /// @brief Minimum time between two saves of Update().
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    PipelineCache() = default;
+
+    /// @brief Default deconstructor.
+    ~PipelineCache() = default;
+
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+
+    // Public Methods
+
+    /// @brief Creates the cache, seeded with the contents of the cache file when they match the device.
+    /// @param device Device the pipelines are created on.
+    /// @param physicalDevice Physical device the cache file must have been written by.
+    /// @param filePath File the cache is loaded from and saved to.
+    /// @return True on success, false otherwise. A missing or mismatching file is not an error.
+    bool Init(const VkDevice device, const VkPhysicalDevice physicalDevice, const std::filesystem::path& filePath);
+
+    /// @brief Saves the cache and destroys it.
+    void Cleanup();
+
+    /// @brief Writes the contents of the cache to the cache file.
+    /// @details Written to a temporary file first, so an interrupted save keeps the previous file.
+    /// Waits for a save started by Update() first.
+    /// @return True on success, false otherwise.
+    bool Save();
+
+    /// @brief Saves the cache if pipelines were compiled since the last save and AUTOSAVE_INTERVAL elapsed.
+    /// @details The contents are read on the calling thread, the file is written on a worker.
+    /// @param workers Pool the file is written on.
+    void Update(WorkerPool& workers);
+
+    /// @brief Accumulates the creation feedback of a pipeline created with the cache.
+    /// @param feedback Feedback chained to the create info of the pipeline.
+    void RecordFeedback(const VkPipelineCreationFeedback& feedback);
+
+    /// @brief Gets the creation feedback accumulated since Init().
+    PipelineCacheStats GetStats() const;
+
+    /// @brief Gets the handle passed to vkCreate*Pipelines.
+    inline VkPipelineCache GetHandle() const { return _cache; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    VkDevice _device{VK_NULL_HANDLE};
+    VkPipelineCache _cache{VK_NULL_HANDLE};
+    VkPhysicalDeviceProperties _deviceProperties{}; /// @brief Identity the header of the cache file is checked against.
+    std::filesystem::path _filePath;
+
+    mutable std::mutex _mutex;                            /// @brief Guards the stats and the save state.
+    PipelineCacheStats _stats;
+    bool _dirty{false};                                   /// @brief Pipelines were compiled since the last save started.
+    std::chrono::steady_clock::time_point _lastSaveTime;
+    std::future<void> _pendingSave;                       /// @brief File write started by Update(), only used by the render thread.
+
+    // Private Methods
+
+    bool IsCompatible(const std::vector<uint8_t>& data) const;
+    bool BeginSave();
+    void EndSave(const bool wasDirty);
+    bool GetData(std::vector<uint8_t>& data) const;
+    bool WriteFile(const std::vector<uint8_t>& data) const;
+};
+
+} // namespace velecs::graphics
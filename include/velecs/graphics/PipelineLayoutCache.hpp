@@ -0,0 +1,119 @@
+/// @file    PipelineLayoutCache.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 21:22:09
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Shader/Reflection/ShaderReflectionData.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @class PipelineLayoutCache
+/// @brief Hash-consed descriptor set layouts and pipeline layouts.
+///
+/// Asking for a layout equal to one created before returns the same handle, so every
+/// program generating its layout from reflection shares the layouts of the others.
+/// Pipelines whose layouts start with the same set layouts keep those sets bound across
+/// pipeline switches. Layouts live until Cleanup(). Safe to use from several threads.
+class PipelineLayoutCache {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    PipelineLayoutCache() = default;
+
+    /// @brief Default deconstructor.
+    ~PipelineLayoutCache() = default;
+
+    PipelineLayoutCache(const PipelineLayoutCache&) = delete;
+    PipelineLayoutCache& operator=(const PipelineLayoutCache&) = delete;
+
+    // Public Methods
+
+    /// @brief Sets the device the layouts are created on.
+    void Init(const VkDevice device);
+
+    /// @brief Destroys every layout.
+    void Cleanup();
+
+    /// @brief Gets the descriptor set layout with some bindings, creating it on first use.
+    /// @details The order of the bindings does not matter. Immutable samplers are not supported.
+    /// @throws std::runtime_error if the layout cannot be created
+    VkDescriptorSetLayout GetDescriptorSetLayout(std::vector<VkDescriptorSetLayoutBinding> bindings);
+
+    /// @brief Gets the pipeline layout over some set layouts and push constant ranges, creating it on first use.
+    /// @throws std::runtime_error if the layout cannot be created
+    VkPipelineLayout GetPipelineLayout(
+        const std::vector<VkDescriptorSetLayout>& setLayouts,
+        const std::vector<VkPushConstantRange>& pushConstantRanges
+    );
+
+    /// @brief Gets the descriptor set layouts of the resources a program reflects.
+    /// @param data Merged reflection data of every stage of the program.
+    /// @param fixedSetLayouts Used as is instead of the reflected bindings of their set, e.g. the bindless heap at set 0.
+    /// Null entries are generated from reflection like the sets after the last fixed one.
+    /// @return One layout per set, up to the last used or fixed set.
+    /// @throws std::runtime_error if a layout cannot be created, or if a generated set holds an array of unknown size
+    std::vector<VkDescriptorSetLayout> GetSetLayouts(
+        const ShaderReflectionData& data,
+        const std::vector<VkDescriptorSetLayout>& fixedSetLayouts
+    );
+
+    /// @brief Gets the pipeline layout of the resources a program reflects.
+    /// @details Same as GetPipelineLayout() over the set layouts of GetSetLayouts().
+    /// @param data Merged reflection data of every stage of the program.
+    /// @param fixedSetLayouts See GetSetLayouts().
+    /// @param pushConstantRanges Push constant ranges of the program.
+    /// @throws std::runtime_error if a layout cannot be created, or if a generated set holds an array of unknown size
+    VkPipelineLayout GetPipelineLayout(
+        const ShaderReflectionData& data,
+        const std::vector<VkDescriptorSetLayout>& fixedSetLayouts,
+        const std::vector<VkPushConstantRange>& pushConstantRanges
+    );
+
+    /// @brief Gets the number of distinct descriptor set layouts created.
+    size_t GetDescriptorSetLayoutCount() const;
+
+    /// @brief Gets the number of distinct pipeline layouts created.
+    size_t GetPipelineLayoutCount() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Hashes the words describing a layout.
+    struct KeyHash {
+        size_t operator()(const std::vector<uint64_t>& key) const;
+    };
+
+    VkDevice _device{VK_NULL_HANDLE};
+
+    mutable std::mutex _mutex;                                                                   /// @brief Guards both maps.
+    std::unordered_map<std::vector<uint64_t>, VkDescriptorSetLayout, KeyHash> _setLayouts;       /// @brief Set layouts by their bindings.
+    std::unordered_map<std::vector<uint64_t>, VkPipelineLayout, KeyHash> _pipelineLayouts;       /// @brief Pipeline layouts by their set layouts and ranges.
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,90 @@
+/// @file    GpuPassStats.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 09:12:37
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace velecs::graphics {
+
+/// @class GpuPassStats
+/// @brief Rolling window of GPU timings for a single render pass.
+///
+/// Keeps the most recent samples in a ring buffer so averages and percentiles
+/// follow the current workload instead of the whole session.
+class GpuPassStats {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const size_t DEFAULT_WINDOW_SIZE;
+
+    // Constructors and Destructors
+
+    /// @brief Constructor.
+    /// @param windowSize Number of most recent samples kept for the statistics.
+    explicit GpuPassStats(const size_t windowSize = DEFAULT_WINDOW_SIZE);
+
+    /// @brief Default deconstructor.
+    ~GpuPassStats() = default;
+
+    // Public Methods
+
+    /// @brief Records a new timing sample, evicting the oldest one if the window is full.
+    /// @param milliseconds Duration of the pass on the GPU.
+    void AddSample(const double milliseconds);
+
+    /// @brief Discards all recorded samples.
+    void Reset();
+
+    /// @brief Gets the number of samples currently in the window.
+    inline size_t GetSampleCount() const { return _samples.size(); }
+
+    /// @brief Gets the total number of samples recorded since creation or the last reset.
+    inline size_t GetTotalSampleCount() const { return _totalSampleCount; }
+
+    /// @brief Gets the most recent sample in milliseconds.
+    inline double GetLatest() const { return _latest; }
+
+    /// @brief Gets the average of the samples in the window in milliseconds.
+    double GetAverage() const;
+
+    /// @brief Gets the smallest sample in the window in milliseconds.
+    double GetMin() const;
+
+    /// @brief Gets the largest sample in the window in milliseconds.
+    double GetMax() const;
+
+    /// @brief Gets a percentile of the samples in the window in milliseconds.
+    /// @param percentile Percentile in the range [0, 100], e.g. 95 for the 95th percentile.
+    /// @return The nearest-rank percentile, or 0 if there are no samples.
+    double GetPercentile(const double percentile) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    size_t _windowSize{DEFAULT_WINDOW_SIZE};
+    std::vector<double> _samples;   /// @brief Ring buffer of the most recent samples.
+    size_t _nextSample{0};          /// @brief Index overwritten by the next sample once the window is full.
+    size_t _totalSampleCount{0};
+    double _latest{0.0};
+    double _sum{0.0};               /// @brief Running sum of the samples in the window.
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
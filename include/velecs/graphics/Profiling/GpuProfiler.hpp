@@ -0,0 +1,168 @@
+/// @file    GpuProfiler.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 09:34:52
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Profiling/GpuPassStats.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace velecs::graphics {
+
+/// @class GpuProfiler
+/// @brief Measures the GPU duration of render passes with timestamp queries.
+///
+/// Owns one timestamp query pool per frame in flight. Results of a frame slot are
+/// collected the next time that slot is recorded, after the frame that last used it completed,
+/// so reading them never stalls the CPU. Statistics therefore lag behind by the
+/// number of frames in flight.
+class GpuProfiler {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const uint32_t DEFAULT_MAX_SCOPES_PER_FRAME;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    GpuProfiler() = default;
+
+    /// @brief Default deconstructor.
+    ~GpuProfiler() = default;
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    // Public Methods
+
+    /// @brief Creates the query pools.
+    /// @param device Logical device owning the query pools.
+    /// @param physicalDevice Physical device used to query the timestamp period.
+    /// @param queueFamily Queue family the profiled command buffers are submitted to.
+    /// @param frameCount Number of frames in flight.
+    /// @param maxScopesPerFrame Maximum number of profiled scopes recorded per frame.
+    /// @return True on success or if timestamps are unsupported (profiling is then disabled), false on error.
+    bool Init(
+        const VkDevice device,
+        const VkPhysicalDevice physicalDevice,
+        const uint32_t queueFamily,
+        const uint32_t frameCount,
+        const uint32_t maxScopesPerFrame = DEFAULT_MAX_SCOPES_PER_FRAME
+    );
+
+    /// @brief Destroys the query pools.
+    void Cleanup();
+
+    /// @brief Checks if the device supports timestamps on the profiled queue.
+    inline bool IsSupported() const { return _timestampPeriod > 0.0f && _validBitsMask != 0; }
+
+    /// @brief Collects the results of the previous use of a frame slot and resets its queries.
+    /// @details Must be called after the frame that last used the slot completed and outside of any rendering scope.
+    /// @param cmd Command buffer of the frame being recorded.
+    /// @param frameIndex Index of the frame slot being recorded.
+    void BeginFrame(const VkCommandBuffer cmd, const uint32_t frameIndex);
+
+    /// @brief Writes the start timestamp of a scope.
+    /// @param cmd Command buffer being recorded.
+    /// @param name Name of the pass, used as the key of its statistics.
+    /// @return Handle to pass to EndScope().
+    uint32_t BeginScope(const VkCommandBuffer cmd, const std::string& name);
+
+    /// @brief Writes the end timestamp of a scope.
+    /// @param cmd Command buffer being recorded.
+    /// @param scope Handle returned by BeginScope().
+    void EndScope(const VkCommandBuffer cmd, const uint32_t scope);
+
+    /// @brief Gets the statistics of a pass.
+    /// @param name Name of the pass.
+    /// @return Pointer to the statistics, or nullptr if the pass was never measured.
+    const GpuPassStats* GetPassStats(const std::string& name) const;
+
+    /// @brief Gets the statistics of every measured pass.
+    inline const std::unordered_map<std::string, GpuPassStats>& GetAllPassStats() const { return _stats; }
+
+    /// @brief Discards the statistics of every pass.
+    void ResetStats();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    static const uint32_t INVALID_SCOPE;
+
+    struct Scope {
+        std::string name;
+        uint32_t beginQuery{0};
+        uint32_t endQuery{0};
+        bool ended{false};
+    };
+
+    struct FrameQueries {
+        VkQueryPool queryPool{VK_NULL_HANDLE};
+        std::vector<Scope> scopes; /// @brief Scopes recorded during the last use of this frame slot.
+        uint32_t queryCount{0};    /// @brief Number of queries written during the last use of this frame slot.
+    };
+
+    VkDevice _device{VK_NULL_HANDLE};
+    float _timestampPeriod{0.0f};        /// @brief Nanoseconds per timestamp tick.
+    uint64_t _validBitsMask{0};          /// @brief Mask of the valid timestamp bits of the queue family.
+    uint32_t _maxQueriesPerFrame{0};
+
+    std::vector<FrameQueries> _frames;
+    uint32_t _currentFrame{0};
+    bool _recording{false};
+
+    std::vector<uint64_t> _results;      /// @brief Scratch storage for query results.
+
+    std::unordered_map<std::string, GpuPassStats> _stats;
+
+    // Private Methods
+
+    void CollectResults(FrameQueries& frame);
+};
+
+/// @class GpuProfileScope
+/// @brief RAII helper writing the begin and end timestamps of a GpuProfiler scope.
+class GpuProfileScope {
+public:
+    // Constructors and Destructors
+
+    /// @brief Begins a scope.
+    /// @param profiler Profiler to record into.
+    /// @param cmd Command buffer being recorded.
+    /// @param name Name of the pass.
+    inline GpuProfileScope(GpuProfiler& profiler, const VkCommandBuffer cmd, const std::string& name)
+        : _profiler(profiler), _cmd(cmd), _scope(profiler.BeginScope(cmd, name)) {}
+
+    /// @brief Ends the scope.
+    inline ~GpuProfileScope() { _profiler.EndScope(_cmd, _scope); }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    // Private Fields
+
+    GpuProfiler& _profiler;
+    VkCommandBuffer _cmd;
+    uint32_t _scope;
+};
+
+} // namespace velecs::graphics
@@ -11,18 +11,42 @@
 #pragma once
 
 #include "velecs/graphics/FrameData.hpp"
+#include "velecs/graphics/RenderEngineConfig.hpp"
 
 #include "velecs/graphics/Memory/UploadContext.hpp"
 #include "velecs/graphics/Memory/DeletionQueue.hpp"
 #include "velecs/graphics/Memory/AllocatedImage.hpp"
 #include "velecs/graphics/Memory/AllocatedBuffer.hpp"
 #include "velecs/graphics/Memory/DescriptorAllocator.hpp"
+#include "velecs/graphics/Memory/UniformRingAllocator.hpp"
+#include "velecs/graphics/Memory/BindlessHeap.hpp"
+
+#include "velecs/graphics/Sync/ImageState.hpp"
+
+#include "velecs/graphics/Profiling/GpuProfiler.hpp"
+
+#include "velecs/graphics/RenderGraph/RenderGraph.hpp"
+
+#include "velecs/graphics/Threading/WorkerPool.hpp"
+#include "velecs/graphics/Threading/RadixSorter.hpp"
+
+#include "velecs/graphics/Culling/Frustum.hpp"
+#include "velecs/graphics/Culling/FrustumCuller.hpp"
+#include "velecs/graphics/Culling/GpuFrustumCuller.hpp"
 
 #include "velecs/graphics/Shader/ShaderPrograms/ComputeShaderProgram.hpp"
 #include "velecs/graphics/Shader/ShaderPrograms/RasterizationShaderProgram.hpp"
+#include "velecs/graphics/Shader/ShaderPrograms/ShaderProgramBatch.hpp"
 #include "velecs/graphics/ComputeEffect.hpp"
+#include "velecs/graphics/PipelineCache.hpp"
+#include "velecs/graphics/PipelineLayoutCache.hpp"
+#include "velecs/graphics/RenderPipelineStateCache.hpp"
+#include "velecs/graphics/Shader/ShaderModuleCache.hpp"
 
 #include "velecs/graphics/Mesh.hpp"
+#include "velecs/graphics/RenderObject.hpp"
+#include "velecs/graphics/DrawPacket.hpp"
+#include "velecs/graphics/Components/Camera.hpp"
 
 #include <velecs/ecs/Scene.hpp>
 using velecs::ecs::Scene;
@@ -39,6 +63,9 @@ using velecs::common::NameUuidRegistry;
 
 #include <optional>
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
 
 namespace velecs::graphics {
 
@@ -68,17 +95,156 @@ public:
 
     // Public Methods
 
+    /// @brief Creates and initializes a rasterization program owned by the render engine.
+    /// @param name Unique name of the program.
+    /// @param uniformRingSet Set the shaders read the uniform ring's per-draw block through, if any.
+    /// Draws bind it at the block written by Mesh::WriteModelUniforms().
+    /// @return The program, which stays valid until Cleanup() and can be assigned to materials.
     template<typename RShaderProgram>
-    void RegisterRasterizationShaderProgram(const std::string& name)
+    RShaderProgram& RegisterRasterizationShaderProgram(
+        const std::string& name,
+        const std::optional<uint32_t> uniformRingSet = std::nullopt
+    )
     {
         if (!_initialized)
             throw std::runtime_error("Cannot register a new rasterization shader program if render engine uninitialized.");
 
         auto [program, uuid] = _rasterPrograms2.EmplaceAs<RShaderProgram>(name);
-        program.Init(_device, _drawImage.imageFormat);
+        if (uniformRingSet.has_value()) program.SetUniformRing(_uniformRing, *uniformRingSet);
+        program.Init(
+            _device,
+            _drawImage.imageFormat,
+            _bindlessHeap.GetDescriptorSetLayout(),
+            &_pipelineCache,
+            &_shaderModuleCache,
+            &_pipelineLayoutCache,
+            &_pipelineStateCache
+        );
+        return static_cast<RShaderProgram&>(program);
     }
 
-    SDL_AppResult Init(SDL_Window* const window);
+    /// @brief Creates a rasterization program owned by the render engine and compiles it on a background thread.
+    /// @details Returns right away so streaming in content does not stall the render thread. Draws using the
+    /// program are skipped until its IsPipelineReady(), then picked up by the next Draw().
+    /// @param name Unique name of the program.
+    /// @param uniformRingSet Set the shaders read the uniform ring's per-draw block through, if any.
+    /// @return The program, which stays valid until Cleanup() and can be assigned to materials right away.
+    template<typename RShaderProgram>
+    RShaderProgram& RegisterRasterizationShaderProgramAsync(
+        const std::string& name,
+        const std::optional<uint32_t> uniformRingSet = std::nullopt
+    )
+    {
+        if (!_initialized)
+            throw std::runtime_error("Cannot register a new rasterization shader program if render engine uninitialized.");
+
+        auto [program, uuid] = _rasterPrograms2.EmplaceAs<RShaderProgram>(name);
+        if (uniformRingSet.has_value()) program.SetUniformRing(_uniformRing, *uniformRingSet);
+        CompileRasterizationShaderProgramAsync(program);
+        return static_cast<RShaderProgram&>(program);
+    }
+
+    SDL_AppResult Init(SDL_Window* const window, const RenderEngineConfig& config = RenderEngineConfig{});
+
+    /// @brief Initializes the render engine without a window, surface, swapchain or ImGui.
+    /// @details Frames are rendered into the draw image and copied into a host visible
+    /// buffer instead of being presented. Use ReadbackFrame() to retrieve the pixels.
+    /// @param extent Size of the offscreen draw image.
+    /// @param config Init-time options.
+    /// @return SDL_APP_CONTINUE on success, SDL_APP_FAILURE otherwise.
+    SDL_AppResult InitHeadless(const VkExtent2D extent, const RenderEngineConfig& config = RenderEngineConfig{});
+
+    /// @brief Gets the options the render engine was initialized with.
+    inline const RenderEngineConfig& GetConfig() const { return _config; }
+
+    /// @brief Gets the present mode selected for the swapchain after falling back from the configured one.
+    inline VkPresentModeKHR GetPresentMode() const { return _presentMode; }
+
+    /// @brief Gets the number of frames in flight.
+    inline size_t GetFrameCount() const { return _frames.size(); }
+
+    /// @brief Checks if AsyncCompute passes run on a separate compute queue.
+    inline bool HasAsyncCompute() const { return _computeQueueFamily != _graphicsQueueFamily; }
+
+    /// @brief Checks if the render engine was initialized without a window.
+    /// @return True if running offscreen, false otherwise.
+    inline bool IsHeadless() const { return _headless; }
+
+    /// @brief Gets the format of the offscreen draw image.
+    /// @return The draw image format, which is also the format of the pixels returned by ReadbackFrame().
+    inline VkFormat GetDrawImageFormat() const { return _drawImage.imageFormat; }
+
+    /// @brief Gets the extent of the offscreen draw image.
+    /// @return The draw image extent.
+    inline VkExtent2D GetDrawImageExtent() const { return VkExtent2D{_drawImage.imageExtent.width, _drawImage.imageExtent.height}; }
+
+    /// @brief Copies the pixels of the most recently submitted frame into the given vector.
+    /// @details Headless mode only. Blocks until the frame finished rendering on the GPU.
+    /// Pixels are tightly packed rows in the draw image format.
+    /// @param pixels Destination, resized to fit the frame.
+    /// @return True if a frame was read back, false otherwise.
+    bool ReadbackFrame(std::vector<uint8_t>& pixels);
+
+    /// @brief Gets the GPU timings of the render passes recorded by Draw().
+    /// @details Pass statistics are keyed by render graph pass name ("Background", "Cull", "Geometry", "Blit",
+    /// "Readback" and "ImGui") plus "Frame" for the whole frame, and lag behind by the number of frames in flight.
+    /// Passes running on the async compute queue are not timed.
+    /// @return The GPU profiler of the render engine.
+    inline const GpuProfiler& GetGpuProfiler() const { return _gpuProfiler; }
+
+    /// @brief Gets the throughput of the last CPU frustum cull.
+    /// @details Only updated when RenderEngineConfig::cpuCulling is set and the scene has a camera.
+    inline const CullStats& GetCpuCullStats() const { return _cpuCuller.GetStats(); }
+
+    /// @brief Gets the value of the last frame the GPU finished.
+    /// @details Frame values count submitted frames from 1, so 0 means no frame finished yet.
+    uint64_t GetCompletedFrameValue() const;
+
+    /// @brief Gets the value of the most recently submitted frame, 0 if none was submitted.
+    inline uint64_t GetSubmittedFrameValue() const { return static_cast<uint64_t>(_frameNumber); }
+
+    /// @brief Checks if the GPU finished a frame and every frame submitted before it.
+    inline bool IsFrameComplete(const uint64_t frameValue) const { return frameValue <= GetCompletedFrameValue(); }
+
+    /// @brief Blocks until the GPU finished a frame.
+    /// @param frameValue Value of the frame to wait on, 0 returns right away.
+    /// @param timeout Timeout in nanoseconds.
+    /// @return True if the frame finished, false on timeout or error.
+    bool WaitForFrame(const uint64_t frameValue, const uint64_t timeout = UINT64_MAX) const;
+
+    /// @brief Gets the context copying data into GPU resources on the transfer queue.
+    /// @details Uploads queued on it are submitted at the start of the next Draw().
+    inline UploadContext& GetUploadContext() { return _uploadContext; }
+
+    /// @brief Gets the allocator of per-frame uniform blocks.
+    /// @details Rewound by Draw() once the frame slot is free, so blocks must be written while the frame is
+    /// recorded, e.g. from render graph passes, and are valid until the slot is recorded again.
+    inline UniformRingAllocator& GetUniformRing() { return _uniformRing; }
+
+    /// @brief Gets the engine-wide pipeline cache.
+    /// @details Pipelines created outside of the render engine can share it through the builders' SetPipelineCache().
+    inline PipelineCache& GetPipelineCache() { return _pipelineCache; }
+
+    /// @brief Gets the global bindless heap.
+    /// @details Only initialized when RenderEngineConfig::bindless is set.
+    inline BindlessHeap& GetBindlessHeap() { return _bindlessHeap; }
+
+    /// @brief Frees an index of the bindless heap once the frames that may read it completed.
+    /// @details Must be called from the render thread.
+    /// @param type Array of the index.
+    /// @param index Index returned when the resource was registered.
+    void ReleaseBindlessIndex(const BindlessHeap::ResourceType type, const uint32_t index);
+
+    /// @brief Checks if uploads run on a separate transfer queue.
+    inline bool HasTransferQueue() const { return _transferQueueFamily != _graphicsQueueFamily; }
+
+    /// @brief Creates the GPU buffers of a mesh and queues the copy of its data.
+    /// @details Draw() skips the mesh until its upload ticket is ready. Previous buffers are
+    /// released once the frames using them finished.
+    /// @param mesh Mesh to upload.
+    /// @return True if the copies were queued, false otherwise.
+    bool UploadMesh(Mesh& mesh);
+
     void StartGUI();
     void EndGUI();
     void Draw(Scene* const scene);
@@ -92,9 +258,27 @@ protected:
 private:
     // Private Fields
 
+    /// @brief Stage at which a frame waits for its swapchain image to be acquired, the stage of the image's first use.
+    static const VkPipelineStageFlags2 SWAPCHAIN_ACQUIRE_WAIT_STAGE;
+
+    /// @brief Fewest draws worth handing to a recording worker, smaller lists use fewer workers.
+    static const size_t MIN_DRAWS_PER_RECORDING_TASK;
+
+    /// @brief Threads compiling asynchronously registered programs, kept apart from the recording workers.
+    static const uint32_t PIPELINE_COMPILE_THREAD_COUNT;
+
+    /// @brief Name of the pipeline cache file in the persistent data directory.
+    static const char* const PIPELINE_CACHE_FILE_NAME;
+
+    /// @brief Name of the shader reflection cache file in the persistent data directory.
+    static const char* const SHADER_REFLECTION_CACHE_FILE_NAME;
+
     bool _initialized{false};
+    RenderEngineConfig _config{}; /// @brief Options the render engine was initialized with.
+    bool _headless{false}; /// @brief True if rendering offscreen without a window.
 
     SDL_Window* _window{nullptr}; /// @brief Pointer to the SDL window structure.
+    VkExtent2D _headlessExtent{}; /// @brief Offscreen extent used in place of the window extent in headless mode.
 
     uint32_t _vulkanApiVersion{0};
     VkInstance _instance{VK_NULL_HANDLE};                     /// @brief Handle to the Vulkan library.
@@ -110,14 +294,25 @@ private:
     std::vector<VkImage> _swapchainImages;               /// @brief List of images within the swapchain.
     std::vector<VkImageView> _swapchainImageViews;       /// @brief List of image views for accessing swapchain images.
     std::vector<VkSemaphore> _renderSemaphores;          /// @brief Semaphores signaled when rendering to swapchain images completes (one per swapchain image).
+    std::vector<ImageState> _swapchainImageStates;       /// @brief Tracked layout and accesses of each swapchain image.
+    VkPresentModeKHR _presentMode{VK_PRESENT_MODE_FIFO_KHR}; /// @brief The present mode selected for the swapchain.
+    bool _swapchainDirty{false};                         /// @brief True if the swapchain is out of date or suboptimal and must be recreated.
 
     size_t _frameNumber{0};
-    static const size_t FRAME_OVERLAP = 2;
-    FrameData _frames[FRAME_OVERLAP];
+    std::vector<FrameData> _frames;         /// @brief Per-frame resources, one per frame in flight.
     VkQueue _graphicsQueue{VK_NULL_HANDLE}; /// @brief Queue used for submitting graphics commands.
     uint32_t _graphicsQueueFamily{0};       /// @brief Index of the queue family for graphics operations.
+    VkQueue _computeQueue{VK_NULL_HANDLE};  /// @brief Queue used for async compute, the graphics queue if the device has no separate one.
+    uint32_t _computeQueueFamily{0};        /// @brief Index of the queue family for async compute, equal to the graphics one if unavailable.
+    VkQueue _transferQueue{VK_NULL_HANDLE}; /// @brief Queue used for uploads, the graphics queue if the device has no separate one.
+    uint32_t _transferQueueFamily{0};       /// @brief Index of the queue family for uploads, equal to the graphics one if unavailable.
+
+    VkSemaphore _graphicsTimeline{VK_NULL_HANDLE}; /// @brief Signaled by each graphics submission with the value of its frame.
+    VkSemaphore _computeTimeline{VK_NULL_HANDLE};  /// @brief Signaled by each async compute submission (async compute only).
+    uint64_t _computeTimelineValue{0};             /// @brief Last value signaled on the compute timeline.
 
     DeletionQueue _mainDeletionQueue;
+    DeletionQueue _retiredDeletionQueue; /// @brief Objects released once the GPU finished the frames using them, keyed by frame value.
 
     VmaAllocator _allocator{nullptr};
 
@@ -126,6 +321,14 @@ private:
 
     DescriptorAllocator _globalDescriptorAllocator;
 
+    PipelineCache _pipelineCache;         /// @brief Shared by every pipeline, persisted between runs.
+    ShaderModuleCache _shaderModuleCache; /// @brief One module per distinct SPIR-V, shared by every program.
+    PipelineLayoutCache _pipelineLayoutCache; /// @brief Layouts generated from reflection, shared by every program.
+    RenderPipelineStateCache _pipelineStateCache; /// @brief One graphics pipeline per distinct state, shared by every program.
+
+    UniformRingAllocator _uniformRing; /// @brief Per-frame uniform blocks bound with dynamic offsets.
+    BindlessHeap _bindlessHeap;        /// @brief Global resource arrays indexed by shaders (bindless only).
+
     VkDescriptorSetLayout _drawImageDescriptorLayout{VK_NULL_HANDLE};
     VkDescriptorSet _drawImageDescriptors{nullptr};
 
@@ -136,32 +339,65 @@ private:
 
     std::vector<std::unique_ptr<RasterizationShaderProgram>> _rasterPrograms;
 
+    GpuProfiler _gpuProfiler; /// @brief Per-pass GPU timestamps of Draw().
+
+    UploadContext _uploadContext; /// @brief Batches copies into GPU resources on the transfer queue.
+
+    RenderGraph _renderGraph; /// @brief Passes of the frame, rebuilt every Draw().
+
+    WorkerPool _workerPool;                     /// @brief Threads recording draw commands in parallel.
+    WorkerPool _pipelineCompileWorkers;         /// @brief Background threads compiling asynchronously registered programs.
+    std::vector<RenderObject> _renderObjects;   /// @brief Draws of the current frame, reused to avoid reallocating every frame.
+    std::vector<InstanceGroup> _instanceGroups; /// @brief Instanced draws of the current frame, one per object without instancing.
+    std::vector<DrawBucket> _drawBuckets;       /// @brief Indirect calls of the current frame (indirect draw only).
+    std::vector<uint32_t> _drawBucketIndices;   /// @brief Bucket of each render object (indirect draw only).
+    bool _indirectDrawsReady{false};            /// @brief True if the frame's indirect draw buffers were written.
+
+    std::vector<DrawPacket> _drawPackets;                       /// @brief Sort keys of the current frame's draws.
+    std::vector<RenderObject> _sortedRenderObjects;             /// @brief Destination of the sort, swapped with the render list.
+    std::unordered_map<const void*, uint32_t> _pipelineSortIds; /// @brief Dense pipeline ids of the current frame.
+    std::unordered_map<const void*, uint32_t> _materialSortIds; /// @brief Dense material ids of the current frame.
+    std::unordered_map<const void*, uint32_t> _meshSortIds;     /// @brief Dense mesh ids of the current frame.
+    RadixSorter _drawSorter;                                    /// @brief Sorts the draw packets by key.
+
+    GpuFrustumCuller _gpuCuller; /// @brief Compute culling of indirect draws (GPU culling only).
+    FrustumCuller _cpuCuller;    /// @brief Worker thread culling of render objects (CPU culling only).
+
     // Private Methods
 
     bool InitVulkan();
     bool InitSwapchain();
+    bool InitDrawImage(const VkExtent2D windowExtent);
+    bool InitWorkers();
     bool InitCommands();
+    bool InitReadbackBuffers();
     bool InitSyncStructures();
+    bool InitRenderSemaphores();
+    bool InitUploadContext();
+    bool InitPipelineCache();
+    bool InitProfiler();
     bool InitDescriptors();
     bool InitPipelines();
     bool InitImgui();
     
     VkExtent2D GetWindowExtent() const;
 
-    void CreateSwapchain(const VkExtent2D extent);
+    bool CreateSwapchain(const VkExtent2D extent, const VkSwapchainKHR oldSwapchain = VK_NULL_HANDLE);
+    bool RecreateSwapchain();
+    VkExtent2D GetDisplayExtent() const;
 
     void CleanupSwapchain();
 
-    bool InitBackgroundPipeline();
+    bool InitBackgroundPipeline(ShaderProgramBatch& batch);
+    bool InitCullingPipeline();
+
+    void CompileRasterizationShaderProgramAsync(RasterizationShaderProgram& program);
 
     FrameData& GetCurrentFrame();
+    size_t GetFrameIndex(const size_t frameNumber) const;
 
-    static void TransitionImage(
-        const VkCommandBuffer cmd,
-        const VkImage image,
-        const VkImageLayout currentLayout,
-        const VkImageLayout newLayout
-    );
+    /// @brief Gets the value the frame being recorded signals on the graphics timeline.
+    inline uint64_t GetRecordingFrameValue() const { return static_cast<uint64_t>(_frameNumber) + 1; }
 
     static void CopyImageToImage(
         const VkCommandBuffer cmd,
@@ -171,90 +407,69 @@ private:
         const VkExtent2D dstSize
     );
 
+    static void CopyImageToBuffer(
+        const VkCommandBuffer cmd,
+        const VkImage source,
+        const VkBuffer destination,
+        const VkExtent2D srcSize
+    );
+
+    static VkDeviceSize GetTexelSize(const VkFormat format);
+
+    bool BuildRenderGraph(Scene* const scene, const uint32_t swapchainImageIndex);
+
+    void DiscardAcquiredImage();
+
+    bool SubmitAsyncCompute(const VkCommandBuffer computeCmd);
+
     void DrawBackground(const VkCommandBuffer cmd);
     void DrawGeometry(const VkCommandBuffer cmd, Scene* const scene);
+    void GatherRenderObjects(Scene* const scene);
+    void CullRenderObjects(Scene* const scene);
+    void SortRenderObjects(Scene* const scene);
+    void BuildInstanceGroups(const bool mergeInstances);
+    bool WriteInstances(InstanceBuffer& instances);
+    bool RecordGeometry(const VkCommandBuffer cmd, const VkCommandPool pool, const size_t begin, const size_t end);
+    void BuildDrawBuckets();
+    bool WriteIndirectDraws(IndirectDrawBuffers& draws, const bool gpuCulled);
+    void PrepareIndirectDraws(Scene* const scene, const bool gpuCulled);
+    void CullGeometry(const VkCommandBuffer cmd, Scene* const scene);
+    bool FindCameraFrustum(Scene* const scene, Frustum& frustum) const;
+    const Camera* FindActiveCamera(Scene* const scene) const;
+    void DrawGeometryIndirect(const VkCommandBuffer cmd);
+    void SetGeometryViewport(const VkCommandBuffer cmd) const;
     void DrawImgui(const VkCommandBuffer cmd, const VkImageView targetImageView);
 
-    // These functions should be better handled
-    void ImmediateSubmit(std::function<void(VkCommandBuffer)>&& function);
+    /// @brief Records commands into the current upload batch, submits it and waits for it to complete.
+    /// @details Resources written through the transfer queue are not released to the graphics queue, prefer the UploadContext methods.
+    /// @return True if the commands completed, false otherwise.
+    bool ImmediateSubmit(std::function<void(VkCommandBuffer)>&& function);
 
+    /// @brief Creates a device local buffer and queues the upload of its contents.
+    /// @param data Elements to upload.
+    /// @param usage Usage of the buffer, VK_BUFFER_USAGE_TRANSFER_DST_BIT is added.
+    /// @param ticket Optional output receiving the ticket of the upload.
+    /// @return The buffer, or nullptr on failure. It must stay alive until the ticket is ready.
     template<typename T>
-    std::optional<AllocatedBuffer> CreateBuffer(const std::vector<T>& data, VkBufferUsageFlags usage)
+    std::unique_ptr<AllocatedBuffer> CreateBuffer(const std::vector<T>& data, VkBufferUsageFlags usage, UploadTicket* const ticket = nullptr)
     {
         const size_t bufferSize = data.size() * sizeof(T);
-        
-        // Create staging buffer (CPU accessible)
-        VkBufferCreateInfo stagingBufferInfo{};
-        stagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        stagingBufferInfo.size = bufferSize;
-        stagingBufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        
-        VmaAllocationCreateInfo stagingAllocInfo{};
-        stagingAllocInfo.usage = VMA_MEMORY_USAGE_CPU_ONLY;
-        
-        AllocatedBuffer stagingBuffer;
-        VkResult result = vmaCreateBuffer(
-            _allocator,
-            &stagingBufferInfo,
-            &stagingAllocInfo,
-            &stagingBuffer._buffer,
-            &stagingBuffer._allocation,
-            nullptr
-        );
-        if (result != VK_SUCCESS)
-        {
-            std::cerr << "Failed to create staging buffer: " << result << std::endl;
-            return std::nullopt; // Fixed: was "return;"
-        }
-        
-        // Copy data to staging buffer
-        void* mappedData;
-        vmaMapMemory(_allocator, stagingBuffer._allocation, &mappedData);
-        memcpy(mappedData, data.data(), bufferSize);
-        vmaUnmapMemory(_allocator, stagingBuffer._allocation);
-        
-        // Create GPU buffer
-        VkBufferCreateInfo gpuBufferInfo{};
-        gpuBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        gpuBufferInfo.size = bufferSize;
-        gpuBufferInfo.usage = usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-        
-        VmaAllocationCreateInfo gpuAllocInfo{};
-        gpuAllocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
-        
-        AllocatedBuffer gpuBuffer;
-        result = vmaCreateBuffer(
+        if (bufferSize == 0) return nullptr;
+
+        std::unique_ptr<AllocatedBuffer> buffer = AllocatedBuffer::TryCreateBuffer(
             _allocator,
-            &gpuBufferInfo,
-            &gpuAllocInfo,
-            &gpuBuffer._buffer,
-            &gpuBuffer._allocation,
-            nullptr
+            bufferSize,
+            usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VMA_MEMORY_USAGE_GPU_ONLY
         );
-        if (result != VK_SUCCESS)
-        {
-            std::cerr << "Failed to create GPU buffer: " << result << std::endl;
-            // Cleanup staging buffer before returning
-            vmaDestroyBuffer(_allocator, stagingBuffer._buffer, stagingBuffer._allocation);
-            return std::nullopt; // Fixed: was "std::optional::none"
-        }
-        
-        // Copy from staging to GPU buffer
-        ImmediateSubmit([=](VkCommandBuffer cmd) {
-            VkBufferCopy copy{};
-            copy.size = bufferSize;
-            vkCmdCopyBuffer(cmd, stagingBuffer._buffer, gpuBuffer._buffer, 1, &copy);
-        });
-        
-        // Cleanup staging buffer
-        vmaDestroyBuffer(_allocator, stagingBuffer._buffer, stagingBuffer._allocation);
-        
-        // Add GPU buffer to deletion queue
-        _mainDeletionQueue.PushDeleter([=]() {
-            vmaDestroyBuffer(_allocator, gpuBuffer._buffer, gpuBuffer._allocation);
-        });
-        
-        return gpuBuffer; // Success case
+        if (!buffer) return nullptr;
+
+        // The data is staged right away, so the vector can be freed once this returns
+        const UploadTicket uploadTicket = _uploadContext.UploadBuffer(*buffer, data.data(), bufferSize);
+        if (!uploadTicket.IsValid()) return nullptr;
+
+        if (ticket != nullptr) *ticket = uploadTicket;
+        return buffer;
     }
 };
 
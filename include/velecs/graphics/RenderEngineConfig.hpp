@@ -0,0 +1,110 @@
+/// @file    RenderEngineConfig.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 10:42:08
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @struct RenderEngineConfig
+/// @brief Init-time options of the render engine.
+///
+/// Passed to RenderEngine::Init() or RenderEngine::InitHeadless(). Changing a
+/// field after initialization has no effect.
+struct RenderEngineConfig {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const uint32_t MIN_FRAMES_IN_FLIGHT = 1;
+    static const uint32_t MAX_FRAMES_IN_FLIGHT = 4;
+    static const uint32_t MIN_SWAPCHAIN_IMAGE_COUNT = 2;
+
+    /// @brief Number of frames the CPU may record ahead of the GPU.
+    /// @details 1 minimizes latency, 3 gives heavy scenes more room to overlap CPU recording with GPU work.
+    /// Every per-frame resource (command pools, semaphores, per-frame buffers) is sized to match.
+    uint32_t framesInFlight{2};
+
+    /// @brief Preferred present mode of the swapchain.
+    /// @details Falls back to the closest supported mode: MAILBOX tries IMMEDIATE next, IMMEDIATE tries MAILBOX next,
+    /// FIFO_RELAXED tries FIFO next. FIFO is always the last resort as it is the only mode guaranteed to be supported.
+    VkPresentModeKHR presentMode{VK_PRESENT_MODE_FIFO_KHR};
+
+    /// @brief Desired minimum number of swapchain images.
+    /// @details The surface may require more or support fewer, in which case the closest valid count is used.
+    uint32_t swapchainImageCount{3};
+
+    /// @brief Number of worker threads used to record draw commands.
+    /// @details 0 uses one per hardware thread. The render thread records alongside the workers.
+    uint32_t workerThreadCount{0};
+
+    /// @brief Size of each frame's region of the uniform ring, in bytes.
+    /// @details The default holds 4096 ObjectUniforms blocks at the common 256 byte offset alignment.
+    VkDeviceSize uniformRingBytesPerFrame{1024 * 1024};
+
+    /// @brief Runs AsyncCompute render graph passes on a separate compute queue when the device has one.
+    /// @details Otherwise they are recorded on the graphics queue in submission order.
+    bool asyncCompute{true};
+
+    /// @brief Draws MeshRenderers with one vkCmdDrawIndexedIndirectCount call per program and mesh.
+    /// @details Requires the drawIndirectCount device feature. Vertex shaders of drawn programs must take an
+    /// IndirectPushConstant and read their ObjectData at gl_InstanceIndex instead of an ObjectPushConstant.
+    bool indirectDraw{false};
+
+    /// @brief Culls indirect draws against the camera frustum in a compute pass before the geometry pass.
+    /// @details Only used with indirectDraw. Scenes without a camera are drawn unculled. Ignored when the library
+    /// was built without glslc, since the culling shader is not compiled.
+    bool gpuCulling{false};
+
+    /// @brief Culls MeshRenderers against the camera frustum on the worker threads before they are drawn.
+    /// @details Portable fallback for devices without GPU culling, skipped when gpuCulling already culls the
+    /// indirect draws. Scenes without a camera are drawn unculled.
+    bool cpuCulling{false};
+
+    /// @brief Draws MeshRenderers sharing a mesh and a material as one instanced draw.
+    /// @details Vertex shaders of drawn programs must follow the indirectDraw contract: take an IndirectPushConstant
+    /// and read their ObjectData at gl_InstanceIndex. The indirect path always merges such draws unless gpuCulling
+    /// is set, since culling tests every instance on its own.
+    bool instancing{false};
+
+    /// @brief Creates the global bindless heap and puts it at set 0 of every registered rasterization program.
+    /// @details Requires the descriptor indexing features for partially bound, update-after-bind arrays of sampled
+    /// images, storage images and storage buffers. The heap is bound once per pipeline switch, shaders select
+    /// resources by the index returned at registration.
+    bool bindless{false};
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+    /// @brief Checks if every option is within its supported range.
+    /// @return True if the configuration can be used, false otherwise.
+    inline bool IsValid() const
+    {
+        return framesInFlight >= MIN_FRAMES_IN_FLIGHT && framesInFlight <= MAX_FRAMES_IN_FLIGHT
+            && swapchainImageCount >= MIN_SWAPCHAIN_IMAGE_COUNT;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
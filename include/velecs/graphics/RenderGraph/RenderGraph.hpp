@@ -0,0 +1,264 @@
+/// @file    RenderGraph.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:41:03
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/RenderGraph/RenderGraphPass.hpp"
+#include "velecs/graphics/RenderGraph/RenderGraphImage.hpp"
+#include "velecs/graphics/RenderGraph/RenderQueue.hpp"
+#include "velecs/graphics/Memory/AllocatedImage.hpp"
+#include "velecs/graphics/Sync/ImageState.hpp"
+#include "velecs/graphics/Sync/ImageUsage.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <vma/vk_mem_alloc.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace velecs::graphics {
+
+class GpuProfiler;
+class ImageBarrierBatch;
+
+/// @class RenderGraph
+/// @brief Frame graph deriving synchronization from declared pass dependencies.
+///
+/// Each frame, passes are added in submission order together with the images they read
+/// and write. Compile() culls the passes whose results never reach an exported image or
+/// a pass with side effects, and assigns memory to transient images, reusing an image
+/// between transients of the same description whose lifetimes do not overlap. Transient
+/// images left unused for as many frames as there are in flight are destroyed.
+/// Execute() records every remaining pass preceded by the barriers derived from the
+/// tracked state of the images it accesses.
+///
+/// With a separate compute queue family, AsyncCompute passes are recorded into their own
+/// command buffer, which must be submitted before the graphics one. Since that submission
+/// runs first, an AsyncCompute pass falls back to the graphics queue if it touches an image
+/// an earlier graphics pass of the frame used, needs an image's contents from the graphics
+/// queue, or uses the image in a way a compute queue does not support. Images used on the
+/// compute queue are handed back to the graphics queue with ownership transfers.
+class RenderGraph {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    RenderGraph() = default;
+
+    /// @brief Default deconstructor.
+    ~RenderGraph() = default;
+
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
+    // Public Methods
+
+    /// @brief Sets the device and allocator used to create transient images.
+    /// @param device Device creating the transient images.
+    /// @param allocator Allocator backing the transient images.
+    /// @param graphicsQueueFamily Queue family of the graphics queue.
+    /// @param computeQueueFamily Queue family of the async compute queue, the graphics family if there is none.
+    /// @param framesInFlight Number of frames the GPU may still be rendering when a frame is compiled.
+    void Init(
+        const VkDevice device,
+        const VmaAllocator allocator,
+        const uint32_t graphicsQueueFamily,
+        const uint32_t computeQueueFamily,
+        const uint32_t framesInFlight
+    );
+
+    /// @brief Destroys every transient image.
+    /// @details The GPU must no longer use them.
+    void Cleanup();
+
+    /// @brief Removes every pass and image of the previous frame, keeping transient memory for reuse.
+    void Reset();
+
+    /// @brief Declares an image owned outside of the graph.
+    /// @param name Name of the image, used in error messages.
+    /// @param image Vulkan image.
+    /// @param imageView View of the whole image.
+    /// @param state Tracked state of the image, kept up to date by the graph across frames.
+    /// @param aspectMask Aspects of the image.
+    /// @return Handle to the image for this frame.
+    RenderGraphImage ImportImage(
+        const std::string& name,
+        const VkImage image,
+        const VkImageView imageView,
+        ImageState& state,
+        const VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT
+    );
+
+    /// @brief Declares an image owned outside of the graph.
+    /// @param name Name of the image, used in error messages.
+    /// @param image Allocated image, its tracked state is kept up to date by the graph.
+    /// @param aspectMask Aspects of the image.
+    /// @return Handle to the image for this frame.
+    RenderGraphImage ImportImage(
+        const std::string& name,
+        AllocatedImage& image,
+        const VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT
+    );
+
+    /// @brief Declares an image only alive during this frame.
+    /// @details Its contents are undefined at its first use.
+    /// @param name Name of the image, used in error messages.
+    /// @param desc Description of the image.
+    /// @return Handle to the image for this frame.
+    RenderGraphImage CreateTransientImage(const std::string& name, const TransientImageDesc& desc);
+
+    /// @brief Marks an image as an output of the frame, keeping alive the passes producing it.
+    /// @param image Image to export.
+    /// @param finalUsage Usage the image is transitioned to after the last pass, e.g. ImageUsage::Present.
+    void ExportImage(const RenderGraphImage image, const std::optional<ImageUsage> finalUsage = std::nullopt);
+
+    /// @brief Adds a pass after every previously added pass.
+    /// @param name Name of the pass, also used for its GPU profiling scope.
+    /// @param queue Queue the pass prefers to run on.
+    /// @return Reference to the pass, valid until Reset().
+    RenderGraphPass& AddPass(const std::string& name, const RenderQueue queue = RenderQueue::Graphics);
+
+    /// @brief Culls unused passes, assigns memory to transient images and picks the queue of each pass.
+    /// @return True on success, false if a transient image could not be created.
+    bool Compile();
+
+    /// @brief Records every pass that survived Compile() and the barriers between them.
+    /// @param cmd Graphics command buffer to record into.
+    /// @param profiler Optional profiler, each graphics pass is recorded inside a scope named after it.
+    /// Passes on the compute queue are not profiled.
+    /// @param computeCmd Compute command buffer receiving the AsyncCompute passes, submitted before cmd.
+    /// If VK_NULL_HANDLE every pass is recorded into cmd.
+    void Execute(
+        const VkCommandBuffer cmd,
+        GpuProfiler* const profiler = nullptr,
+        const VkCommandBuffer computeCmd = VK_NULL_HANDLE
+    );
+
+    /// @brief Checks if the device has a compute queue family separate from the graphics one.
+    inline bool IsAsyncComputeAvailable() const { return _computeQueueFamily != _graphicsQueueFamily; }
+
+    /// @brief Gets the stages of the graphics submission that must wait for the compute submission.
+    /// @details Valid after Execute(), VK_PIPELINE_STAGE_2_NONE if nothing recorded on the compute queue is used.
+    inline VkPipelineStageFlags2 GetComputeWaitStages() const { return _computeWaitStages; }
+
+    /// @brief Gets the Vulkan image behind a handle.
+    /// @details For transient images only valid after Compile().
+    VkImage GetImage(const RenderGraphImage image) const;
+
+    /// @brief Gets the view of the Vulkan image behind a handle.
+    /// @details For transient images only valid after Compile().
+    VkImageView GetImageView(const RenderGraphImage image) const;
+
+    /// @brief Gets the passes added this frame in submission order.
+    inline const std::vector<std::unique_ptr<RenderGraphPass>>& GetPasses() const { return _passes; }
+
+    /// @brief Gets the number of transient images currently backed by memory.
+    inline size_t GetPhysicalImageCount() const { return _physicalImages.size(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    static const uint32_t NO_PASS;
+
+    struct ImageResource {
+        std::string name;
+        bool transient{false};
+        VkImageAspectFlags aspectMask{VK_IMAGE_ASPECT_COLOR_BIT};
+
+        // Imported images
+        VkImage image{VK_NULL_HANDLE};
+        VkImageView imageView{VK_NULL_HANDLE};
+        ImageState* state{nullptr};
+
+        // Transient images
+        TransientImageDesc desc{};
+        uint32_t physicalIndex{NO_PASS};
+        uint32_t firstPass{NO_PASS}; /// @brief Index of the first pass using the image after culling.
+        uint32_t lastPass{NO_PASS};  /// @brief Index of the last pass using the image after culling.
+        bool written{false};         /// @brief True once a pass wrote the image during Execute().
+
+        bool exported{false};
+        std::optional<ImageUsage> finalUsage;
+    };
+
+    /// @brief Release recorded on the compute queue, waiting for its acquire on the graphics queue.
+    struct PendingAcquire {
+        bool pending{false};
+        VkImageLayout oldLayout{VK_IMAGE_LAYOUT_UNDEFINED};
+    };
+
+    struct PhysicalImage {
+        TransientImageDesc desc{};
+        AllocatedImage image{};
+        uint32_t availableAfter{NO_PASS}; /// @brief Last pass using the image this frame, NO_PASS if unused.
+        uint32_t unusedFrames{0};         /// @brief Number of consecutive frames the image was not used.
+    };
+
+    VkDevice _device{VK_NULL_HANDLE};
+    VmaAllocator _allocator{VK_NULL_HANDLE};
+
+    uint32_t _graphicsQueueFamily{VK_QUEUE_FAMILY_IGNORED};
+    uint32_t _computeQueueFamily{VK_QUEUE_FAMILY_IGNORED};
+    uint32_t _framesInFlight{1};
+    VkPipelineStageFlags2 _computeWaitStages{VK_PIPELINE_STAGE_2_NONE};
+
+    std::vector<std::unique_ptr<RenderGraphPass>> _passes;
+    std::vector<ImageResource> _images;
+    std::vector<std::unique_ptr<PhysicalImage>> _physicalImages; /// @brief Transient memory, kept across frames.
+
+    // Private Methods
+
+    void CullPasses();
+    void ComputeLifetimes();
+    bool AssignPhysicalImages();
+    bool CreatePhysicalImage(const TransientImageDesc& desc, PhysicalImage& physicalImage);
+    void DestroyPhysicalImage(PhysicalImage& physicalImage);
+    void TrimPhysicalImages();
+    void AssignQueues();
+
+    void ExecuteComputePasses(const VkCommandBuffer cmd, std::vector<PendingAcquire>& pendingAcquires);
+    void ExecuteGraphicsPasses(
+        const VkCommandBuffer cmd,
+        GpuProfiler* const profiler,
+        const bool skipAsyncCompute,
+        std::vector<PendingAcquire>& pendingAcquires
+    );
+    void TransitionForPass(
+        ImageBarrierBatch& barriers,
+        ImageResource& resource,
+        const RenderGraphPass::ImageAccess& access,
+        const uint32_t queueFamily,
+        std::vector<PendingAcquire>& pendingAcquires
+    );
+    bool RunsOnComputeQueue(const RenderGraphPass& pass, const VkCommandBuffer computeCmd) const;
+    uint32_t GetQueueFamily(const bool compute) const;
+    bool HasState(const ImageResource& resource) const;
+    size_t GetStateKey(const ImageResource& resource) const;
+
+    static bool IsComputeQueueUsage(const ImageUsage usage);
+
+    const ImageResource& GetResource(const RenderGraphImage image) const;
+    ImageState& GetState(ImageResource& resource);
+    VkImage GetImage(const ImageResource& resource) const;
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,69 @@
+/// @file    RenderGraphImage.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:06:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace velecs::graphics {
+
+/// @struct RenderGraphImage
+/// @brief Handle to an image declared in a RenderGraph.
+///
+/// Only valid for the frame it was created in, handles are invalidated by RenderGraph::Reset().
+struct RenderGraphImage {
+public:
+    // Public Fields
+
+    static const uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index{INVALID_INDEX};
+
+    // Public Methods
+
+    /// @brief Checks if the handle refers to an image.
+    inline bool IsValid() const { return index != INVALID_INDEX; }
+
+    inline bool operator==(const RenderGraphImage& other) const { return index == other.index; }
+    inline bool operator!=(const RenderGraphImage& other) const { return index != other.index; }
+};
+
+/// @struct TransientImageDesc
+/// @brief Description of an image owned by the render graph and only alive during a frame.
+///
+/// Transient images with equal descriptions and non-overlapping lifetimes share the same memory.
+struct TransientImageDesc {
+public:
+    // Public Fields
+
+    VkExtent3D extent{0, 0, 1};
+    VkFormat format{VK_FORMAT_UNDEFINED};
+    VkImageUsageFlags usage{0};
+    VkImageAspectFlags aspectMask{VK_IMAGE_ASPECT_COLOR_BIT};
+
+    // Public Methods
+
+    inline bool operator==(const TransientImageDesc& other) const
+    {
+        return extent.width == other.extent.width
+            && extent.height == other.extent.height
+            && extent.depth == other.extent.depth
+            && format == other.format
+            && usage == other.usage
+            && aspectMask == other.aspectMask;
+    }
+
+    inline bool operator!=(const TransientImageDesc& other) const { return !(*this == other); }
+};
+
+} // namespace velecs::graphics
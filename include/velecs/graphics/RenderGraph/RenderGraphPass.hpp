@@ -0,0 +1,119 @@
+/// @file    RenderGraphPass.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:14:27
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/RenderGraph/RenderGraphImage.hpp"
+#include "velecs/graphics/RenderGraph/RenderQueue.hpp"
+#include "velecs/graphics/Sync/ImageUsage.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @class RenderGraphPass
+/// @brief A pass of a RenderGraph and the images it accesses.
+///
+/// Passes declare how they access each image, the graph derives the barriers
+/// recorded before the pass from these declarations. Each image should only be
+/// declared once per pass, use a read-write usage when a pass does both.
+class RenderGraphPass {
+public:
+    // Enums
+
+    // Public Fields
+
+    using ExecuteFunction = std::function<void(const VkCommandBuffer cmd)>;
+
+    /// @struct ImageAccess
+    /// @brief Declared access of a pass to an image.
+    struct ImageAccess {
+        RenderGraphImage image;
+        ImageUsage usage{ImageUsage::Undefined};
+        bool write{false};   /// @brief True if the pass modifies the image.
+        bool discard{false}; /// @brief True if the pass overwrites the whole image and does not need its previous contents.
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Constructor.
+    /// @param name Name of the pass, also used for its GPU profiling scope.
+    /// @param queue Queue the pass prefers to run on.
+    RenderGraphPass(const std::string& name, const RenderQueue queue);
+
+    /// @brief Default deconstructor.
+    ~RenderGraphPass() = default;
+
+    // Public Methods
+
+    /// @brief Declares that the pass reads an image.
+    /// @param image Image read by the pass.
+    /// @param usage How the image is read.
+    /// @return Reference to this pass for method chaining.
+    RenderGraphPass& Read(const RenderGraphImage image, const ImageUsage usage);
+
+    /// @brief Declares that the pass writes an image.
+    /// @param image Image written by the pass.
+    /// @param usage How the image is written.
+    /// @param discard True if the whole image is overwritten, making earlier writers unnecessary.
+    /// @return Reference to this pass for method chaining.
+    RenderGraphPass& Write(const RenderGraphImage image, const ImageUsage usage, const bool discard = false);
+
+    /// @brief Sets the function recording the commands of the pass.
+    /// @param function Function called with the command buffer of the pass's queue.
+    /// @return Reference to this pass for method chaining.
+    RenderGraphPass& SetExecute(ExecuteFunction&& function);
+
+    /// @brief Marks the pass as having effects outside of the graph (e.g. readbacks), so it is never culled.
+    /// @param hasSideEffects True to keep the pass alive even if none of its writes are used.
+    /// @return Reference to this pass for method chaining.
+    RenderGraphPass& SetSideEffects(const bool hasSideEffects = true);
+
+    inline const std::string& GetName() const { return _name; }
+    inline RenderQueue GetQueue() const { return _queue; }
+    inline const std::vector<ImageAccess>& GetImageAccesses() const { return _imageAccesses; }
+    inline bool HasSideEffects() const { return _hasSideEffects; }
+
+    /// @brief Checks if the pass was culled by the last RenderGraph::Compile().
+    inline bool IsCulled() const { return _culled; }
+
+    /// @brief Checks if the last RenderGraph::Compile() scheduled the pass on the async compute queue.
+    inline bool IsAsyncCompute() const { return _asyncCompute; }
+
+    /// @brief Records the commands of the pass.
+    /// @param cmd Command buffer to record into.
+    void Execute(const VkCommandBuffer cmd) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    friend class RenderGraph;
+
+    std::string _name;
+    RenderQueue _queue{RenderQueue::Graphics};
+    std::vector<ImageAccess> _imageAccesses;
+    ExecuteFunction _execute;
+    bool _hasSideEffects{false};
+    bool _culled{false};
+    bool _asyncCompute{false}; /// @brief Queue picked by RenderGraph::Compile(), may differ from the preferred one.
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
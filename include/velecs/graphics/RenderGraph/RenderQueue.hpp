@@ -0,0 +1,24 @@
+/// @file    RenderQueue.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:02:11
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+namespace velecs::graphics {
+
+/// @enum RenderQueue
+/// @brief Queue a render graph pass prefers to run on.
+///
+/// AsyncCompute passes run on the graphics queue when the device has no separate compute queue.
+enum class RenderQueue {
+    Graphics = 0,
+    AsyncCompute,
+};
+
+} // namespace velecs::graphics
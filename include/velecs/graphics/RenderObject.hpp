@@ -0,0 +1,57 @@
+/// @file    RenderObject.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:20:05
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Mesh.hpp"
+#include "velecs/graphics/Material.hpp"
+#include "velecs/graphics/Shader/ShaderPrograms/RasterizationShaderProgram.hpp"
+
+#include <velecs/math/Mat4.hpp>
+using velecs::math::Mat4;
+
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @struct RenderObject
+/// @brief Everything needed to record the draw of one mesh renderer.
+///
+/// Gathered from the scene on the render thread so recording can be split
+/// across worker threads without touching the scene.
+struct RenderObject {
+    const Mesh* mesh{nullptr};                          /// @brief Mesh to draw, owned by its MeshRenderer.
+    const RasterizationShaderProgram* program{nullptr}; /// @brief Program of the renderer's material.
+    const Material* material{nullptr};                  /// @brief Material of the renderer.
+    Mat4 worldMatrix;                                   /// @brief World matrix of the entity's transform.
+};
+
+/// @struct InstanceGroup
+/// @brief Contiguous render objects sharing a program, a material and a mesh.
+///
+/// Drawn by a single instanced draw whose firstInstance is the first object, so
+/// each instance reads the ObjectData of its own render object.
+struct InstanceGroup {
+    uint32_t firstObject{0};   /// @brief Index of the first render object of the group.
+    uint32_t instanceCount{0}; /// @brief Number of render objects in the group.
+};
+
+/// @struct DrawBucket
+/// @brief Contiguous render objects sharing a program and an index buffer.
+///
+/// Drawn by a single vkCmdDrawIndexedIndirectCount call on the indirect path.
+struct DrawBucket {
+    const RasterizationShaderProgram* program{nullptr}; /// @brief Program bound for the whole bucket.
+    const Mesh* mesh{nullptr};                          /// @brief Mesh whose index buffer is bound for the whole bucket.
+    uint32_t firstDraw{0};                              /// @brief Index of the first render object of the bucket.
+    uint32_t drawCount{0};                              /// @brief Number of render objects in the bucket.
+};
+
+} // namespace velecs::graphics
@@ -11,6 +11,8 @@
 #pragma once
 
 #include "velecs/graphics/PipelineBuilderBase.hpp"
+#include "velecs/graphics/RenderPipelineStateKey.hpp"
+#include "velecs/graphics/RenderPipelineStateCache.hpp"
 
 #include "velecs/graphics/Shader/Shaders/VertexShader.hpp"
 #include "velecs/graphics/Shader/Shaders/GeometryShader.hpp"
@@ -55,6 +57,21 @@ public:
 
     RenderPipelineBuilder& SetShaders(const std::vector<VkPipelineShaderStageCreateInfo>& shaderStages);
 
+    /// @brief Sets the SPIR-V of the stages given to SetShaders(), in the same order.
+    /// @details Required with a pipeline state cache, which keys shaders by their code since the handle
+    /// of a destroyed module can be reused by another one.
+    /// @param shaderCode Code of each stage, must stay alive until GetPipeline() returns.
+    RenderPipelineBuilder& SetShaderCode(const std::vector<const std::vector<uint32_t>*>& shaderCode);
+
+    /// @brief Sets what the pipeline layout was created from.
+    /// @details Required with a pipeline state cache, for the same reason as SetShaderCode().
+    /// @param setLayouts Descriptor set layouts of the pipeline layout.
+    /// @param pushConstantRanges Push constant ranges of the pipeline layout.
+    RenderPipelineBuilder& SetPipelineLayoutDescription(
+        const std::vector<VkDescriptorSetLayout>& setLayouts,
+        const std::vector<VkPushConstantRange>& pushConstantRanges
+    );
+
     /// @brief Sets vertex input description
     RenderPipelineBuilder& SetVertexInput(const VkPipelineVertexInputStateCreateInfo& vertexInput);
 
@@ -84,6 +101,15 @@ public:
     /// @brief Enables/disables depth testing
     RenderPipelineBuilder& SetDepthTest(bool enable, bool write = true, VkCompareOp compareOp = VK_COMPARE_OP_LESS);
 
+    /// @brief Shares the pipeline with every earlier request of the same state through a cache.
+    /// @details Pipelines from GetPipeline() must then be released through the cache instead of destroyed.
+    /// @param pipelineStateCache Engine-wide cache, nullptr to always create a new pipeline
+    RenderPipelineBuilder& SetPipelineStateCache(RenderPipelineStateCache* const pipelineStateCache);
+
+    /// @brief Flattens the configured state into a key, equal for builders creating interchangeable pipelines.
+    /// @throws std::runtime_error if the shader code or the pipeline layout description is missing
+    RenderPipelineStateKey GetStateKey() const;
+
     void Clear();
 
 protected:
@@ -100,6 +126,10 @@ private:
     // Private Fields
 
     std::vector<VkPipelineShaderStageCreateInfo> _shaderStages; /// @brief Collection of shader stages to be used in the pipeline
+    std::vector<const std::vector<uint32_t>*> _shaderCode;      /// @brief SPIR-V of each stage, not owned.
+
+    std::optional<std::vector<VkDescriptorSetLayout>> _setLayouts; /// @brief Set layouts of the pipeline layout, if described.
+    std::vector<VkPushConstantRange> _pushConstantRanges;          /// @brief Push constant ranges of the pipeline layout.
 
     VkPipelineVertexInputStateCreateInfo _vertexInputInfo; /// @brief Description of the format of the vertex data.
     
@@ -117,7 +147,12 @@ private:
 
     VkFormat _colorAttachmentFormat;
 
+    RenderPipelineStateCache* _pipelineStateCache{nullptr}; /// @brief Optional cache, not owned.
+
     // Private Methods
+
+    /// @brief Creates a new pipeline from the configured state.
+    VkPipeline CompilePipeline();
 };
 
 } // namespace velecs::graphics
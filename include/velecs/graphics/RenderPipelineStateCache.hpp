@@ -0,0 +1,97 @@
+/// @file    RenderPipelineStateCache.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 21:58:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/RenderPipelineStateKey.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+namespace velecs::graphics {
+
+/// @class RenderPipelineStateCache
+/// @brief Shares one VkPipeline between every graphics pipeline request with the same state.
+///
+/// Material permutations tend to request identical pipelines, only the first request
+/// compiles. A request arriving while the same state compiles on another thread waits
+/// for it instead of compiling again. Each Acquire() must be matched by a Release(),
+/// the pipeline is destroyed once nothing references it. Safe to use from several threads.
+class RenderPipelineStateCache {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    RenderPipelineStateCache() = default;
+
+    /// @brief Default deconstructor.
+    ~RenderPipelineStateCache() = default;
+
+    RenderPipelineStateCache(const RenderPipelineStateCache&) = delete;
+    RenderPipelineStateCache& operator=(const RenderPipelineStateCache&) = delete;
+
+    // Public Methods
+
+    /// @brief Sets the device the pipelines are destroyed on.
+    void Init(const VkDevice device);
+
+    /// @brief Destroys every pipeline, including the ones still referenced.
+    /// @details Later Release() calls of those pipelines are ignored.
+    void Cleanup();
+
+    /// @brief Gets the pipeline of some state, creating it on first use.
+    /// @param key State of the pipeline.
+    /// @param create Creates the pipeline when no equal state was requested before.
+    /// @return The pipeline, referenced until the matching Release().
+    /// @throws Whatever create throws, also to the requests waiting for it.
+    VkPipeline Acquire(const RenderPipelineStateKey& key, const std::function<VkPipeline()>& create);
+
+    /// @brief Drops a reference taken by Acquire(), destroying the pipeline with its last reference.
+    void Release(const VkPipeline pipeline);
+
+    /// @brief Gets the number of distinct pipelines alive.
+    size_t GetPipelineCount() const;
+
+    /// @brief Gets the number of requests served with a pipeline created before.
+    uint64_t GetReuseCount() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    struct Entry {
+        std::shared_future<VkPipeline> pipeline; /// @brief Ready once the first request created it.
+        uint32_t refCount{0};
+    };
+
+    VkDevice _device{VK_NULL_HANDLE};
+
+    mutable std::mutex _mutex;                                                                 /// @brief Guards everything below.
+    std::unordered_map<RenderPipelineStateKey, Entry, RenderPipelineStateKeyHash> _entries;    /// @brief Pipelines by state.
+    std::unordered_map<VkPipeline, const RenderPipelineStateKey*> _pipelineKeys;               /// @brief State of every created pipeline, for Release().
+    uint64_t _reuseCount{0};
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,72 @@
+/// @file    RenderPipelineStateKey.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 21:58:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @struct RenderPipelineStateKey
+/// @brief Every piece of state a graphics pipeline is created from, flattened into plain words.
+///
+/// Built by RenderPipelineBuilder::GetStateKey(). Shaders are keyed by their SPIR-V and the
+/// pipeline layout by its set layouts and push constant ranges, so a destroyed module or
+/// layout whose handle gets reused never matches the pipelines created from it.
+/// Equal keys create interchangeable pipelines.
+struct RenderPipelineStateKey {
+public:
+    // Enums
+
+    // Public Fields
+
+    std::vector<uint64_t> words;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    RenderPipelineStateKey() = default;
+
+    /// @brief Default deconstructor.
+    ~RenderPipelineStateKey() = default;
+
+    // Public Methods
+
+    void Append(const uint64_t word);
+
+    /// @brief Appends the bit pattern of a float, so equal floats give equal words.
+    void AppendFloat(const float value);
+
+    /// @brief Appends a byte count followed by the bytes, zero padded to whole words.
+    void AppendBytes(const void* const data, const size_t size);
+
+    inline bool operator==(const RenderPipelineStateKey& other) const { return words == other.words; }
+    inline bool operator!=(const RenderPipelineStateKey& other) const { return words != other.words; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @struct RenderPipelineStateKeyHash
+/// @brief FNV-1a hash of the words of a key, for unordered containers.
+struct RenderPipelineStateKeyHash {
+    size_t operator()(const RenderPipelineStateKey& key) const;
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,93 @@
+/// @file    ShaderReflectionCache.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 20:14:53
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Shader/Reflection/ShaderReflectionData.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @class ShaderReflectionCache
+/// @brief Reflection data of shaders keyed by a hash of their SPIR-V, entry point and stage.
+///
+/// Saved to a compact binary file so later runs skip SPIR-V parsing for every shader
+/// that did not change. Files of another format version are ignored. Safe to use from
+/// several threads.
+class ShaderReflectionCache {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const uint32_t FILE_MAGIC;   /// @brief First word of a cache file.
+    static const uint32_t FILE_VERSION; /// @brief Bumped whenever the layout of the reflection data changes.
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    ShaderReflectionCache() = default;
+
+    /// @brief Default deconstructor.
+    ~ShaderReflectionCache() = default;
+
+    ShaderReflectionCache(const ShaderReflectionCache&) = delete;
+    ShaderReflectionCache& operator=(const ShaderReflectionCache&) = delete;
+
+    // Public Methods
+
+    /// @brief Computes the key of a shader.
+    static uint64_t MakeKey(const std::vector<uint32_t>& spirvCode, const std::string& entryPoint, const VkShaderStageFlagBits stage);
+
+    /// @brief Looks up the reflection data of a shader.
+    /// @param key Key from MakeKey().
+    /// @param data Receives the cached data when found.
+    /// @return True if the shader was cached, false otherwise.
+    bool Find(const uint64_t key, ShaderReflectionData& data) const;
+
+    /// @brief Caches the reflection data of a shader.
+    void Insert(const uint64_t key, const ShaderReflectionData& data);
+
+    /// @brief Adds the entries of a cache file to the cache.
+    /// @details A missing file, a file of another version or a truncated file adds nothing.
+    /// @return True if the file was read, false otherwise.
+    bool Load(const std::filesystem::path& filePath);
+
+    /// @brief Writes every entry to a cache file if entries were inserted since the last Save().
+    /// @return True on success or if there was nothing to write, false otherwise.
+    bool Save(const std::filesystem::path& filePath);
+
+    /// @brief Gets the number of cached shaders.
+    size_t GetEntryCount() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    mutable std::mutex _mutex;                                  /// @brief Guards the entries.
+    std::unordered_map<uint64_t, ShaderReflectionData> _entries;
+    bool _dirty{false};                                         /// @brief Entries were inserted since the last Save().
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
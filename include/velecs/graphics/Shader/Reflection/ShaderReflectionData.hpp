@@ -12,6 +12,8 @@
 
 #include "velecs/graphics/Shader/Reflection/ShaderResource.hpp"
 
+#include <vulkan/vulkan_core.h>
+
 #include <vector>
 
 namespace velecs::graphics {
@@ -51,6 +53,11 @@ public:
 
     ShaderReflectionData Merge(const ShaderReflectionData& other) const;
 
+    /// @brief Gets the descriptor set layout bindings of the resources, grouped by set.
+    /// @details The descriptor count of a binding is the arraySize of its resource, 0 for arrays of unknown size.
+    /// @return Bindings indexed by set number, sets between the used ones are empty.
+    std::vector<std::vector<VkDescriptorSetLayoutBinding>> GetSetLayoutBindings() const;
+
     friend std::ostream& operator<<(std::ostream& os, const ShaderReflectionData& data);
 
 protected:
@@ -64,6 +71,12 @@ private:
     // Private Methods
 
     static std::vector<ShaderResource> MergeResourceVector(const std::vector<ShaderResource>& a, const std::vector<ShaderResource>& b);
+
+    static void AddSetLayoutBindings(
+        std::vector<std::vector<VkDescriptorSetLayoutBinding>>& sets,
+        const std::vector<ShaderResource>& resources,
+        const VkDescriptorType descriptorType
+    );
 };
 
 } // namespace velecs::graphics
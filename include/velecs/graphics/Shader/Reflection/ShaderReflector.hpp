@@ -12,14 +12,35 @@
 
 #include "velecs/graphics/Shader/Reflection/ShaderReflectionData.hpp"
 
+#include <filesystem>
+
 namespace velecs::graphics {
 
 class Shader;
 
 /// @brief Reflects a shader and extracts its resource information
+/// @details Memoized per SPIR-V hash, only the first call for some code parses it,
+///          with the built-in word stream parser.
 /// @param shader The shader to reflect
 /// @return Reflection data containing all discovered resources
 /// @throws std::runtime_error if reflection fails
 ShaderReflectionData Reflect(const Shader& shader);
 
+/// @brief Reflects a shader through SPIRV-Cross, bypassing the memo
+/// @details Reference backend to validate the built-in parser against, far slower than Reflect().
+/// @param shader The shader to reflect
+/// @return Reflection data containing all discovered resources
+/// @throws std::runtime_error if reflection fails
+ShaderReflectionData ReflectWithSpirVCross(const Shader& shader);
+
+/// @brief Seeds the reflection memo with a file written by SaveReflectionCache()
+/// @param filePath Cache file
+/// @return True if the file was read, false if it is missing or unusable
+bool LoadReflectionCache(const std::filesystem::path& filePath);
+
+/// @brief Writes the reflection memo to a file if shaders were reflected since the last save
+/// @param filePath Cache file
+/// @return True on success, false otherwise
+bool SaveReflectionCache(const std::filesystem::path& filePath);
+
 } // namespace velecs::graphics
@@ -31,14 +31,15 @@ public:
 
     // Public Fields
 
-    ShaderResourceType type;
-    VkShaderStageFlags stages;
+    ShaderResourceType type{ShaderResourceType::Unknown};
+    VkShaderStageFlags stages{0};
 
     std::string name;
     uint32_t offset{0};
     uint32_t size{0};
     uint32_t set{0};
     uint32_t binding{0};
+    uint32_t arraySize{1}; /// @brief Descriptor count of the binding, 0 for runtime or specialization sized arrays.
 
     std::vector<ShaderMember> members;
 
@@ -55,6 +56,9 @@ public:
     bool operator==(const ShaderResource& other) const;
     bool operator!=(const ShaderResource& other) const;
 
+    /// @brief Hashes the fields compared by operator==, so equal resources have equal keys.
+    uint64_t GetKeyHash() const;
+
     friend std::ostream& operator<<(std::ostream& os, const ShaderResource& resource);
 
 protected:
@@ -0,0 +1,32 @@
+/// @file    SpirVParser.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 20:48:31
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Shader/Reflection/ShaderReflectionData.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @brief Reflects SPIR-V code with a single pass over its word stream
+/// @details Only the names, decorations, types and global variables reflection needs are
+///          recorded, into flat tables indexed by id, no IR is built. Scanning stops at the
+///          first function. Yields the same data as the SPIRV-Cross backend.
+/// @param spirvCode SPIR-V bytecode
+/// @param stage Stage written into the stages of every resource
+/// @return Reflection data containing all discovered resources
+/// @throws std::runtime_error if the code is not valid SPIR-V
+ShaderReflectionData ParseSpirV(const std::vector<uint32_t>& spirvCode, const VkShaderStageFlagBits stage);
+
+} // namespace velecs::graphics
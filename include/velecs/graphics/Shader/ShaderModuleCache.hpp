@@ -0,0 +1,93 @@
+/// @file    ShaderModuleCache.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 19:21:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @class ShaderModuleCache
+/// @brief Shares one VkShaderModule between every shader with the same SPIR-V and entry point.
+///
+/// Modules are looked up by an FNV-1a hash of the code and entry point, then compared
+/// in full so a hash collision never returns the wrong module. Each Acquire() must be
+/// matched by a Release(), the module is destroyed once nothing references it. Safe
+/// to use from several threads.
+class ShaderModuleCache {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    ShaderModuleCache() = default;
+
+    /// @brief Default deconstructor.
+    ~ShaderModuleCache() = default;
+
+    ShaderModuleCache(const ShaderModuleCache&) = delete;
+    ShaderModuleCache& operator=(const ShaderModuleCache&) = delete;
+
+    // Public Methods
+
+    /// @brief Sets the device the modules are created on.
+    void Init(const VkDevice device);
+
+    /// @brief Destroys every module, including the ones still referenced.
+    /// @details Later Release() calls of those modules are ignored.
+    void Cleanup();
+
+    /// @brief Gets the module of some SPIR-V code, creating it on first use.
+    /// @param spirvCode SPIR-V bytecode of the module.
+    /// @param entryPoint Entry point the module is used with.
+    /// @return The module, referenced until the matching Release().
+    /// @throws std::runtime_error if the module cannot be created
+    VkShaderModule Acquire(const std::vector<uint32_t>& spirvCode, const std::string& entryPoint);
+
+    /// @brief Drops a reference taken by Acquire(), destroying the module with its last reference.
+    void Release(const VkShaderModule module);
+
+    /// @brief Gets the number of distinct modules alive.
+    size_t GetModuleCount() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    struct Entry {
+        std::vector<uint32_t> spirvCode; /// @brief Compared on lookup to rule out hash collisions.
+        std::string entryPoint;
+        VkShaderModule module{VK_NULL_HANDLE};
+        uint32_t refCount{0};
+    };
+
+    VkDevice _device{VK_NULL_HANDLE};
+
+    mutable std::mutex _mutex;                                    /// @brief Guards the entries.
+    std::unordered_multimap<uint64_t, Entry> _entries;            /// @brief Modules by content hash.
+    std::unordered_map<VkShaderModule, uint64_t> _moduleHashes;   /// @brief Content hash of every module, for Release().
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
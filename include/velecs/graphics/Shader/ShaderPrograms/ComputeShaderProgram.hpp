@@ -50,12 +50,27 @@ public:
 
     void SetComputeShader(const std::shared_ptr<ComputeShader>& shader);
 
+    /// @brief Sets the descriptor set bound at set 0 by Dispatch().
+    /// @details Optional, programs without one only get push constants. Its layout is used as is
+    /// for set 0, also when the other sets are generated from reflection.
     void SetDescriptor(const VkDescriptorSetLayout descriptorSetLayout, const VkDescriptorSet descriptorSet);
 
-    void Init(const VkDevice device);
+    /// @brief Creates the pipeline layout and the pipeline.
+    /// @param device Device owning the pipeline.
+    /// @param pipelineCache Cache the pipeline is created with, optional.
+    /// @param shaderModuleCache Cache the shader module is acquired from, optional.
+    /// @param pipelineLayoutCache Cache the pipeline layout is generated from reflection with, optional.
+    void Init(
+        const VkDevice device,
+        PipelineCache* const pipelineCache = nullptr,
+        ShaderModuleCache* const shaderModuleCache = nullptr,
+        PipelineLayoutCache* const pipelineLayoutCache = nullptr
+    );
 
     void SetGroupCount(const uint32_t x, const uint32_t y = 1, const uint32_t z = 1);
 
+    /// @brief Records the dispatch into a command buffer of any queue family supporting compute.
+    /// @param cmd Graphics or async compute command buffer.
     void Dispatch(const VkCommandBuffer cmd);
 
 protected:
@@ -79,6 +94,9 @@ private:
 
     std::shared_ptr<ComputeShader> _comp;
 
+    PipelineCache* _pipelineCache{nullptr};         /// @brief Not owned, only used during Init().
+    ShaderModuleCache* _shaderModuleCache{nullptr}; /// @brief Not owned, only used during Init().
+
     VkDescriptorSetLayout _descriptorSetLayout{VK_NULL_HANDLE};
     VkDescriptorSet _descriptorSet{VK_NULL_HANDLE};
 
@@ -95,7 +113,7 @@ private:
 
         if (_device)
         {
-            if (_pipelineLayout)
+            if (_pipelineLayout && !_pipelineLayoutCache)
                 vkDestroyPipelineLayout(_device, _pipelineLayout, nullptr);
             if (_pipeline)
                 vkDestroyPipeline(_device, _pipeline, nullptr);
@@ -18,11 +18,13 @@
 #include "velecs/graphics/Shader/Shaders/TessellationControlShader.hpp"
 #include "velecs/graphics/Shader/Shaders/TessellationEvaluationShader.hpp"
 
+#include "velecs/graphics/Memory/UniformRingAllocator.hpp"
 #include "velecs/graphics/RenderPipelineLayoutBuilder.hpp"
 #include "velecs/graphics/RenderPipelineBuilder.hpp"
 
 #include <vulkan/vulkan_core.h>
 
+#include <atomic>
 #include <optional>
 
 namespace velecs::graphics {
@@ -64,13 +66,51 @@ public:
     void SetTessellationControlShader(const std::shared_ptr<TessellationControlShader>& tesc);
     void SetTessellationEvaluationShader(const std::shared_ptr<TessellationEvaluationShader>& tese);
 
+    /// @brief Reads per-draw blocks of a uniform ring through one set of the pipeline layout.
+    /// @details Must be called before Init(), RenderEngine registration does so when given a uniform ring set.
+    /// The set gets the ring's UNIFORM_BUFFER_DYNAMIC layout instead of a reflected one, bind it with
+    /// UniformRingAllocator::Bind().
+    /// @param uniformRing Initialized ring, must outlive the program.
+    /// @param set Set of the ring's block in the shaders, after the bindless heap if there is one.
+    void SetUniformRing(const UniformRingAllocator& uniformRing, const uint32_t set);
+
     RenderPipelineBuilder& DebugGetBuilder()
     {
         std::cerr << "[WARNING] `DebugGetBuilder()` is function used for testing purposes only and should be removed." << std::endl;
         return pipelineBuilder;
     }
 
-    void Init(const VkDevice device, const VkFormat colorAttachmentFormat);
+    /// @brief Creates the pipeline layout and the pipeline.
+    /// @param device Device owning the pipeline.
+    /// @param colorAttachmentFormat Format of the color attachment drawn into.
+    /// @param bindlessLayout Layout of the bindless heap, put at set 0 of the pipeline layout when not null.
+    /// @param pipelineCache Cache the pipeline is created with, optional.
+    /// @param shaderModuleCache Cache the shader modules are acquired from, optional.
+    /// @param pipelineLayoutCache Cache the pipeline layout is generated from reflection with, optional.
+    /// The sets after the bindless heap then get the descriptor set layouts of the reflected resources.
+    /// @param pipelineStateCache Cache sharing the pipeline with programs of the same state, optional.
+    void Init(
+        const VkDevice device,
+        const VkFormat colorAttachmentFormat,
+        const VkDescriptorSetLayout bindlessLayout = VK_NULL_HANDLE,
+        PipelineCache* const pipelineCache = nullptr,
+        ShaderModuleCache* const shaderModuleCache = nullptr,
+        PipelineLayoutCache* const pipelineLayoutCache = nullptr,
+        RenderPipelineStateCache* const pipelineStateCache = nullptr
+    );
+
+    /// @brief Checks if Init() finished creating the pipeline.
+    /// @details Safe to call while Init() runs on another thread, the pipeline can be used once it returns true.
+    inline bool IsPipelineReady() const { return _pipelineReady.load(std::memory_order_acquire); }
+
+    /// @brief Checks if the pipeline layout has the bindless heap at set 0.
+    inline bool UsesBindlessHeap() const { return _bindlessLayout != VK_NULL_HANDLE; }
+
+    /// @brief Checks if the pipeline layout reads a uniform ring, see SetUniformRing().
+    inline bool UsesUniformRing() const { return _uniformRingLayout != VK_NULL_HANDLE; }
+
+    /// @brief Gets the set of the uniform ring in the pipeline layout.
+    inline uint32_t GetUniformRingSet() const { return _uniformRingSet; }
     
     void Draw(const VkCommandBuffer cmd, const VkExtent2D extent);
 
@@ -93,6 +133,12 @@ private:
     // Private Fields
 
     bool _initialized{false};
+    std::atomic<bool> _pipelineReady{false}; /// @brief Published once the pipeline exists, read by the render thread.
+
+    VkDescriptorSetLayout _bindlessLayout{VK_NULL_HANDLE}; /// @brief Not owned, the render engine owns the bindless heap.
+    VkDescriptorSetLayout _uniformRingLayout{VK_NULL_HANDLE}; /// @brief Not owned, null if no uniform ring is read.
+    uint32_t _uniformRingSet{0};
+    RenderPipelineStateCache* _pipelineStateCache{nullptr}; /// @brief Not owned, owns the pipeline when set.
 
     std::shared_ptr<VertexShader>                 _vert{nullptr}; /// @brief Vertex shader (required)
     std::shared_ptr<GeometryShader>               _geom{nullptr}; /// @brief Geometry shader (optional)
@@ -12,6 +12,7 @@
 
 #include "velecs/graphics/Shader/Reflection/ShaderReflectionData.hpp"
 #include "velecs/graphics/Shader/PushConstant.hpp"
+#include "velecs/graphics/PipelineLayoutCache.hpp"
 
 #include <vulkan/vulkan_core.h>
 
@@ -60,6 +61,18 @@ public:
     /// @return Count of non-null shader stages
     virtual size_t GetStageCount() const = 0;
 
+    /// @brief Gets the pipeline created by Init().
+    /// @return The pipeline, or VK_NULL_HANDLE if not initialized.
+    inline VkPipeline GetPipeline() const { return _pipeline; }
+
+    /// @brief Gets the pipeline layout created by Init().
+    /// @return The pipeline layout, or VK_NULL_HANDLE if not initialized.
+    inline VkPipelineLayout GetPipelineLayout() const { return _pipelineLayout; }
+
+    /// @brief Gets the shader stages that read the push constant.
+    /// @return The stages of the push constant range, or 0 if none was configured.
+    inline VkShaderStageFlags GetPushConstantStages() const { return _pushConstant ? _pushConstant->GetRange().stageFlags : 0; }
+
     /// @brief Configures push constants for this compute program (call before Init())
     template<typename PushConstantType>
     void ConfigurePushConstants()
@@ -123,6 +136,8 @@ protected:
     VkPipelineLayout _pipelineLayout{VK_NULL_HANDLE};
     VkPipeline _pipeline{VK_NULL_HANDLE};
 
+    PipelineLayoutCache* _pipelineLayoutCache{nullptr}; /// @brief Not owned, owns the pipeline layout when set.
+
     VkDevice _device;
 
     // Protected Methods
@@ -0,0 +1,109 @@
+/// @file    ShaderProgramBatch.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 18:47:05
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Shader/ShaderPrograms/ComputeShaderProgram.hpp"
+#include "velecs/graphics/Shader/ShaderPrograms/RasterizationShaderProgram.hpp"
+#include "velecs/graphics/PipelineCache.hpp"
+#include "velecs/graphics/Threading/WorkerPool.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <functional>
+#include <future>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @class ShaderProgramBatch
+/// @brief Initializes shader programs concurrently on a worker pool.
+///
+/// Each added program is initialized by a worker, creating its pipeline layout and
+/// pipeline alongside the others. Vulkan allows concurrent pipeline creation on one
+/// device and cache. Programs must be fully configured before being added and must
+/// not be touched until their future is ready or Wait() returned. Programs are added
+/// from a single thread.
+class ShaderProgramBatch {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Constructor.
+    /// @param workerPool Pool the programs are initialized on.
+    /// @param device Device owning the pipelines.
+    /// @param pipelineCache Cache the pipelines are created with, optional.
+    /// @param shaderModuleCache Cache the shader modules are acquired from, optional.
+    /// @param pipelineLayoutCache Cache the pipeline layouts are generated with, optional.
+    /// @param pipelineStateCache Cache sharing graphics pipelines of the same state, optional.
+    ShaderProgramBatch(
+        WorkerPool& workerPool,
+        const VkDevice device,
+        PipelineCache* const pipelineCache = nullptr,
+        ShaderModuleCache* const shaderModuleCache = nullptr,
+        PipelineLayoutCache* const pipelineLayoutCache = nullptr,
+        RenderPipelineStateCache* const pipelineStateCache = nullptr
+    );
+
+    /// @brief Waits for the queued programs, they reference objects owned by the caller.
+    inline ~ShaderProgramBatch() { Wait(); }
+
+    ShaderProgramBatch(const ShaderProgramBatch&) = delete;
+    ShaderProgramBatch& operator=(const ShaderProgramBatch&) = delete;
+
+    // Public Methods
+
+    /// @brief Queues the initialization of a compute program.
+    /// @param program Configured program, must outlive the batch.
+    /// @return Future that becomes ready once the program was initialized, rethrowing anything Init() threw.
+    std::shared_future<void> Add(ComputeShaderProgram& program);
+
+    /// @brief Queues the initialization of a rasterization program.
+    /// @param program Configured program, must outlive the batch.
+    /// @param colorAttachmentFormat Format of the color attachment drawn into.
+    /// @param bindlessLayout Layout of the bindless heap, put at set 0 of the pipeline layout when not null.
+    /// @return Future that becomes ready once the program was initialized, rethrowing anything Init() threw.
+    std::shared_future<void> Add(
+        RasterizationShaderProgram& program,
+        const VkFormat colorAttachmentFormat,
+        const VkDescriptorSetLayout bindlessLayout = VK_NULL_HANDLE
+    );
+
+    /// @brief Blocks until every queued program was initialized.
+    /// @details Logs the programs that failed.
+    /// @return True if every program queued since the last Wait() was initialized, false otherwise.
+    bool Wait();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    WorkerPool& _workerPool;
+    VkDevice _device{VK_NULL_HANDLE};
+    PipelineCache* _pipelineCache{nullptr};
+    ShaderModuleCache* _shaderModuleCache{nullptr};
+    PipelineLayoutCache* _pipelineLayoutCache{nullptr};
+    RenderPipelineStateCache* _pipelineStateCache{nullptr};
+
+    std::vector<std::shared_future<void>> _pending; /// @brief Programs queued since the last Wait().
+
+    // Private Methods
+
+    std::shared_future<void> Queue(std::function<void()>&& job);
+};
+
+} // namespace velecs::graphics
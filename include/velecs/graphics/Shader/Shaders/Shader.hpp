@@ -11,6 +11,7 @@
 #pragma once
 
 #include "velecs/graphics/VulkanInitializers.hpp"
+#include "velecs/graphics/Shader/ShaderModuleCache.hpp"
 
 #include <vulkan/vulkan_core.h>
 
@@ -20,6 +21,7 @@
 #include <memory>
 #include <fstream>
 #include <filesystem>
+#include <mutex>
 
 namespace velecs::graphics {
 
@@ -75,8 +77,12 @@ public:
     inline const std::string& GetEntryPoint() const { return _entryPoint; }
 
     /// @brief Gets the pipeline shader stage create info
+    /// @details The module is created on the first call and reused by later ones, so programs sharing
+    /// the shader share its module. Safe to call from several threads.
+    /// @param device Device the module is created on.
+    /// @param moduleCache Cache the module is acquired from, optional. Must outlive the module.
     /// @return Create info for use with VkGraphicsPipelineCreateInfo
-    VkPipelineShaderStageCreateInfo GetCreateInfo(const VkDevice device);
+    VkPipelineShaderStageCreateInfo GetCreateInfo(const VkDevice device, ShaderModuleCache* const moduleCache = nullptr);
 
     /// @brief Reloads the shader from its source file (only works for file-based shaders)
     /// @return Reference to this shader for method chaining
@@ -112,7 +118,9 @@ private:
     std::string _entryPoint;                             /// @brief Entry point function name
     std::vector<uint32_t> _spirvCode;                    /// @brief SPIR-V bytecode
     VkShaderModule _module{VK_NULL_HANDLE};              /// @brief The compiled shader module
+    ShaderModuleCache* _moduleCache{nullptr};            /// @brief Cache the module was acquired from, null if owned
     VkPipelineShaderStageCreateInfo _stageCreateInfo{};  /// @brief Pipeline stage create info
+    std::mutex _moduleMutex;                             /// @brief Guards the module creation
 
     // Private Methods
 
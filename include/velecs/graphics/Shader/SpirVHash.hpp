@@ -0,0 +1,36 @@
+/// @file    SpirVHash.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 19:58:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @brief Offset basis of the 64-bit FNV-1a hash, the hash of no bytes.
+extern const uint64_t FNV1A_OFFSET_BASIS;
+
+/// @brief Hashes bytes with 64-bit FNV-1a.
+/// @param data Bytes to hash.
+/// @param size Number of bytes.
+/// @param hash Hash of the preceding bytes, to hash several ranges as one.
+/// @return Hash of the preceding bytes followed by data.
+uint64_t Fnv1a(const void* const data, const size_t size, const uint64_t hash = FNV1A_OFFSET_BASIS);
+
+/// @brief Hashes SPIR-V code together with the entry point it is used with.
+/// @param spirvCode SPIR-V bytecode.
+/// @param entryPoint Entry point name.
+/// @return FNV-1a hash of the code words followed by the entry point.
+uint64_t HashSpirV(const std::vector<uint32_t>& spirvCode, const std::string& entryPoint);
+
+} // namespace velecs::graphics
@@ -0,0 +1,126 @@
+/// @file    ImageBarrierBatch.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 12:05:19
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Sync/ImageState.hpp"
+#include "velecs/graphics/Sync/ImageUsage.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <vector>
+
+namespace velecs::graphics {
+
+/// @class ImageBarrierBatch
+/// @brief Collects image transitions and records them with a single pipeline barrier.
+///
+/// Barriers are derived from the tracked ImageState of each image, so they only wait
+/// on the stages that last accessed the image and only flush its writes. Reads
+/// following reads in the same layout do not emit a barrier at all.
+/// An image must not be transitioned twice in the same batch.
+class ImageBarrierBatch {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    ImageBarrierBatch() = default;
+
+    /// @brief Default deconstructor.
+    ~ImageBarrierBatch() = default;
+
+    // Public Methods
+
+    /// @brief Queues the transition of an image to a usage.
+    /// @param image Image to transition.
+    /// @param state Tracked state of the image, updated to the new usage.
+    /// @param usage How the image will be accessed next.
+    /// @param discard True if the previous contents are not needed, allowing a transition from VK_IMAGE_LAYOUT_UNDEFINED.
+    /// @param aspectMask Aspects of the image to transition.
+    void Transition(
+        const VkImage image,
+        ImageState& state,
+        const ImageUsage usage,
+        const bool discard = false,
+        const VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT
+    );
+
+    /// @brief Queues the transition of an image to an explicit state.
+    /// @param image Image to transition.
+    /// @param state Tracked state of the image, updated to the new state.
+    /// @param newState Layout, stages and accesses of the next use.
+    /// @param discard True if the previous contents are not needed, allowing a transition from VK_IMAGE_LAYOUT_UNDEFINED.
+    /// @param aspectMask Aspects of the image to transition.
+    void Transition(
+        const VkImage image,
+        ImageState& state,
+        const ImageState& newState,
+        const bool discard = false,
+        const VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT
+    );
+
+    /// @brief Queues the release half of a queue family ownership transfer.
+    /// @details Recorded on the queue currently owning the image. Must be matched by an Acquire() with the same
+    /// layouts on the destination queue, after a semaphore wait on this submission.
+    /// @param image Image to release.
+    /// @param state Tracked state of the image, left with no pending accesses and owned by the destination family.
+    /// @param dstQueueFamily Queue family receiving the image.
+    /// @param newLayout Layout of the image on the destination queue, the transition is part of the transfer.
+    /// @param aspectMask Aspects of the image to release.
+    void Release(
+        const VkImage image,
+        ImageState& state,
+        const uint32_t dstQueueFamily,
+        const VkImageLayout newLayout,
+        const VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT
+    );
+
+    /// @brief Queues the acquire half of a queue family ownership transfer.
+    /// @details Recorded on the queue receiving the image. The semaphore the submission waits on orders it after the release.
+    /// @param image Image to acquire.
+    /// @param state Tracked state of the image, updated to the new state.
+    /// @param srcQueueFamily Queue family the image was released from.
+    /// @param oldLayout Layout the image was released from.
+    /// @param newState Layout, stages, accesses and queue family of the next use, the layout must match the release.
+    /// @param aspectMask Aspects of the image to acquire.
+    void Acquire(
+        const VkImage image,
+        ImageState& state,
+        const uint32_t srcQueueFamily,
+        const VkImageLayout oldLayout,
+        const ImageState& newState,
+        const VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT
+    );
+
+    /// @brief Records every queued transition with one vkCmdPipelineBarrier2 and clears the batch.
+    /// @param cmd Command buffer to record into.
+    void Flush(const VkCommandBuffer cmd);
+
+    /// @brief Checks if no transition is queued.
+    inline bool IsEmpty() const { return _imageBarriers.empty(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::vector<VkImageMemoryBarrier2> _imageBarriers;
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
@@ -0,0 +1,69 @@
+/// @file    ImageState.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 11:44:10
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/Sync/ImageUsage.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+namespace velecs::graphics {
+
+/// @struct ImageState
+/// @brief Tracked layout and last accesses of an image.
+///
+/// Stores the stages and accesses of every use since the last barrier, so the
+/// next barrier only waits on what actually touched the image.
+struct ImageState {
+public:
+    // Enums
+
+    // Public Fields
+
+    VkImageLayout layout{VK_IMAGE_LAYOUT_UNDEFINED}; /// @brief Current layout of the image.
+    VkPipelineStageFlags2 stages{VK_PIPELINE_STAGE_2_NONE}; /// @brief Stages that accessed the image since the last barrier.
+    VkAccessFlags2 accesses{VK_ACCESS_2_NONE};        /// @brief Accesses made to the image since the last barrier.
+    uint32_t queueFamily{VK_QUEUE_FAMILY_IGNORED};    /// @brief Queue family owning the image, ignored unless the image is shared across families.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+    /// @brief Gets the layout, stages and accesses matching a usage.
+    /// @param usage How the image will be accessed.
+    /// @return The state of an image after being accessed that way.
+    static ImageState FromUsage(const ImageUsage usage);
+
+    /// @brief Checks if the state includes any write access.
+    inline bool HasWrites() const { return IsWriteAccess(accesses); }
+
+    /// @brief Checks if the access flags contain any write access.
+    /// @param accesses Access flags to check.
+    /// @return True if any write bit is set, false otherwise.
+    static bool IsWriteAccess(const VkAccessFlags2 accesses);
+
+    /// @brief Keeps only the write bits of access flags.
+    /// @details Only writes need to be made available by a barrier, reads only need an execution dependency.
+    /// @param accesses Access flags to filter.
+    /// @return The write bits of the given flags.
+    static VkAccessFlags2 GetWriteAccesses(const VkAccessFlags2 accesses);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
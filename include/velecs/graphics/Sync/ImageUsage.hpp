@@ -0,0 +1,36 @@
+/// @file    ImageUsage.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 11:38:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+namespace velecs::graphics {
+
+/// @enum ImageUsage
+/// @brief How a pass accesses an image.
+///
+/// Each usage maps to the layout, pipeline stages and access flags of the access,
+/// see ImageState::FromUsage().
+enum class ImageUsage {
+    Undefined = 0,
+    ComputeStorageRead,
+    ComputeStorageWrite,
+    ComputeStorageReadWrite,
+    ComputeSampledRead,
+    FragmentSampledRead,
+    ColorAttachment,
+    DepthAttachment,
+    BlitSrc,
+    BlitDst,
+    CopySrc,
+    CopyDst,
+    Present,
+};
+
+} // namespace velecs::graphics
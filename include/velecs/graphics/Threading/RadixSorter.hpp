@@ -0,0 +1,73 @@
+/// @file    RadixSorter.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 16:08:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/graphics/DrawPacket.hpp"
+#include "velecs/graphics/Threading/WorkerPool.hpp"
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @class RadixSorter
+/// @brief Sorts draw packets by key with a stable least significant digit radix sort.
+///
+/// Runs one pass per key byte, skipping bytes equal in every key. Large lists
+/// are split across the worker pool: each task counts the digits of its range, then
+/// scatters it to offsets derived from every task's counts, which keeps the sort
+/// stable and its result independent of the thread count. Scratch memory is kept
+/// between calls.
+class RadixSorter {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const size_t MIN_PACKETS_PER_TASK; /// @brief Smallest range worth handing to a worker.
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    RadixSorter() = default;
+
+    /// @brief Default deconstructor.
+    ~RadixSorter() = default;
+
+    RadixSorter(const RadixSorter&) = delete;
+    RadixSorter& operator=(const RadixSorter&) = delete;
+
+    // Public Methods
+
+    /// @brief Sorts packets by ascending key, packets with equal keys keep their order.
+    /// @param packets Packets to sort in place.
+    /// @param workerPool Pool running the tasks, the calling thread runs the first one.
+    void Sort(std::vector<DrawPacket>& packets, WorkerPool& workerPool);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    using Histogram = std::array<uint32_t, 256>;
+
+    std::vector<DrawPacket> _scratch;    /// @brief Destination of every other pass.
+    std::vector<Histogram> _histograms;  /// @brief Digit counts of each task, turned into scatter offsets.
+
+    // Private Methods
+};
+
+} // namespace velecs::graphics
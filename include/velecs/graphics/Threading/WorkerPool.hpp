@@ -0,0 +1,93 @@
+/// @file    WorkerPool.hpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:12:47
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+namespace velecs::graphics {
+
+/// @class WorkerPool
+/// @brief Fixed set of threads that run jobs submitted by the render engine.
+///
+/// Threads are started by Init() and joined by Cleanup(). Jobs are run in
+/// submission order by whichever worker becomes free first, so callers that need
+/// a deterministic result must write to slots owned by the job rather than to
+/// shared state.
+class WorkerPool {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    WorkerPool() = default;
+
+    /// @brief Default deconstructor.
+    inline ~WorkerPool() { Cleanup(); }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Public Methods
+
+    /// @brief Starts the worker threads.
+    /// @param threadCount Number of threads to start, 0 uses one per hardware thread.
+    /// @return True on success, false otherwise.
+    bool Init(const uint32_t threadCount = 0);
+
+    /// @brief Finishes the queued jobs and joins the worker threads.
+    void Cleanup();
+
+    /// @brief Gets the number of worker threads.
+    inline uint32_t GetThreadCount() const { return static_cast<uint32_t>(_threads.size()); }
+
+    /// @brief Queues a job to run on a worker thread.
+    /// @param job Function to run.
+    /// @return Future that becomes ready once the job ran, rethrowing anything it threw.
+    std::future<void> Submit(std::function<void()>&& job);
+
+    /// @brief Runs a function once for every task index and waits for all of them.
+    /// @details Task 0 runs on the calling thread while the others are queued, so at most
+    /// GetThreadCount() + 1 tasks run concurrently. Rethrows the first exception thrown by a task
+    /// after every task finished.
+    /// @param taskCount Number of tasks.
+    /// @param task Function called with the task index.
+    void ParallelFor(const size_t taskCount, const std::function<void(const size_t)>& task);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::vector<std::thread> _threads;           /// @brief Worker threads.
+    std::deque<std::packaged_task<void()>> _jobs; /// @brief Jobs waiting for a free worker.
+    std::mutex _mutex;                           /// @brief Guards the job queue and stop flag.
+    std::condition_variable _condition;          /// @brief Wakes workers when a job is queued or the pool stops.
+    bool _stopping{false};                       /// @brief True once Cleanup() asked the workers to exit.
+
+    // Private Methods
+
+    void WorkerLoop();
+};
+
+} // namespace velecs::graphics
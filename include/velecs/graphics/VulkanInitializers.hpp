@@ -28,11 +28,13 @@ VkFenceCreateInfo VkExtFenceCreateInfo(const VkFenceCreateFlags flags = 0);
 
 VkSemaphoreCreateInfo VkExtSemaphoreCreateInfo(const VkSemaphoreCreateFlags flags = 0);
 
+VkSemaphoreTypeCreateInfo VkExtSemaphoreTypeCreateInfo(const VkSemaphoreType semaphoreType, const uint64_t initialValue = 0);
+
 VkCommandBufferBeginInfo VkExtCommandBufferBeginInfo(const VkCommandBufferUsageFlags flags = 0);
 
 VkImageSubresourceRange VkExtImageSubresourceRange(const VkImageAspectFlags aspectMask);
 
-VkSemaphoreSubmitInfo VkExtSemaphoreSubmitInfo(const VkPipelineStageFlags2 stageMask, const VkSemaphore semaphore);
+VkSemaphoreSubmitInfo VkExtSemaphoreSubmitInfo(const VkPipelineStageFlags2 stageMask, const VkSemaphore semaphore, const uint64_t value = 1);
 
 VkCommandBufferSubmitInfo VkExtCommandBufferSubmitInfo(const VkCommandBuffer cmd);
 
@@ -61,7 +63,13 @@ VkRenderingAttachmentInfo VkExtRenderingAttachmentInfo(
 VkRenderingInfo VkExtRenderingInfo(
     const VkExtent2D renderExtent,
     const VkRenderingAttachmentInfo* const colorAttachment,
-    const VkRenderingAttachmentInfo* const depthAttachment
+    const VkRenderingAttachmentInfo* const depthAttachment,
+    const VkRenderingFlags flags = 0
+);
+
+VkCommandBufferInheritanceRenderingInfo VkExtCommandBufferInheritanceRenderingInfo(
+    const VkFormat* const colorAttachmentFormat,
+    const VkFormat depthAttachmentFormat = VK_FORMAT_UNDEFINED
 );
 
 
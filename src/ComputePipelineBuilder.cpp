@@ -27,6 +27,12 @@ ComputePipelineBuilder& ComputePipelineBuilder::SetComputeShader(const std::shar
     return *this;
 }
 
+ComputePipelineBuilder& ComputePipelineBuilder::SetShaderModuleCache(ShaderModuleCache* const shaderModuleCache)
+{
+    _shaderModuleCache = shaderModuleCache;
+    return *this;
+}
+
 // Protected Fields
 
 // Protected Methods
@@ -37,10 +43,17 @@ VkPipeline ComputePipelineBuilder::CreatePipeline()
     info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
     info.pNext = nullptr;
     info.layout = _pipelineLayout;
-    info.stage = _compShader->GetCreateInfo(_device);
+    info.stage = _compShader->GetCreateInfo(_device, _shaderModuleCache);
+
+    VkPipelineCreationFeedback feedback{};
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo{};
+    feedbackInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
+    feedbackInfo.pNext = nullptr;
+    feedbackInfo.pPipelineCreationFeedback = &feedback;
+    info.pNext = &feedbackInfo;
 
     VkPipeline pipeline;
-    VkResult result = vkCreateComputePipelines(_device, VK_NULL_HANDLE, 1, &info, nullptr, &pipeline);
+    VkResult result = vkCreateComputePipelines(_device, GetPipelineCacheHandle(), 1, &info, nullptr, &pipeline);
     if (result != VK_SUCCESS)
     {
         std::ostringstream oss;
@@ -48,6 +61,8 @@ VkPipeline ComputePipelineBuilder::CreatePipeline()
         throw std::runtime_error(oss.str());
     }
 
+    RecordFeedback(feedback);
+
     return pipeline;
 }
 
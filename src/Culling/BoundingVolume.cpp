@@ -0,0 +1,62 @@
+/// @file    BoundingVolume.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 15:31:06
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Culling/BoundingVolume.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+BoundingVolume BoundingVolume::Transform(const Mat4& worldMatrix) const
+{
+    float w[16];
+    std::memcpy(w, &worldMatrix, sizeof(w));
+
+    BoundingVolume result{};
+    for (int r{0}; r < 3; ++r)
+    {
+        result.center[r] = w[0 * 4 + r] * center[0] + w[1 * 4 + r] * center[1] + w[2 * 4 + r] * center[2] + w[3 * 4 + r];
+    }
+
+    // The largest axis scale keeps the sphere conservative under non-uniform scaling
+    float maxScaleSquared{0.0f};
+    for (int col{0}; col < 3; ++col)
+    {
+        const float scaleSquared = w[col * 4 + 0] * w[col * 4 + 0] + w[col * 4 + 1] * w[col * 4 + 1] + w[col * 4 + 2] * w[col * 4 + 2];
+        maxScaleSquared = std::max(maxScaleSquared, scaleSquared);
+    }
+    result.radius = radius * std::sqrt(maxScaleSquared);
+
+    // Extents of the box rotated by the matrix
+    for (int r{0}; r < 3; ++r)
+    {
+        result.extents[r] = std::abs(w[0 * 4 + r]) * extents[0] + std::abs(w[1 * 4 + r]) * extents[1] + std::abs(w[2 * 4 + r]) * extents[2];
+    }
+
+    return result;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
@@ -0,0 +1,93 @@
+/// @file    Frustum.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:52:19
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Culling/Frustum.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace velecs::graphics {
+
+static_assert(sizeof(Mat4) == 16 * sizeof(float));
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+Frustum Frustum::FromCamera(const Mat4& projection, const Mat4& view)
+{
+    float p[16];
+    float v[16];
+    std::memcpy(p, &projection, sizeof(p));
+    std::memcpy(v, &view, sizeof(v));
+
+    // Column-major, element (row, col) is at [col * 4 + row]
+    float m[16];
+    for (int col{0}; col < 4; ++col)
+    {
+        for (int row{0}; row < 4; ++row)
+        {
+            float sum{0.0f};
+            for (int k{0}; k < 4; ++k) sum += p[k * 4 + row] * v[col * 4 + k];
+            m[col * 4 + row] = sum;
+        }
+    }
+
+    auto row = [&m](const int r, const int c) { return m[c * 4 + r]; };
+
+    // Gribb and Hartmann, the near plane is z >= 0 since Vulkan clips depth to [0, 1]
+    Frustum frustum{};
+    for (int c{0}; c < 4; ++c)
+    {
+        frustum.planes[0][c] = row(3, c) + row(0, c); // Left
+        frustum.planes[1][c] = row(3, c) - row(0, c); // Right
+        frustum.planes[2][c] = row(3, c) + row(1, c); // Bottom
+        frustum.planes[3][c] = row(3, c) - row(1, c); // Top
+        frustum.planes[4][c] = row(2, c);             // Near
+        frustum.planes[5][c] = row(3, c) - row(2, c); // Far
+    }
+
+    for (float* const plane : frustum.planes)
+    {
+        const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (length <= 0.0f) continue;
+        for (int c{0}; c < 4; ++c) plane[c] /= length;
+    }
+
+    return frustum;
+}
+
+bool Frustum::Intersects(const BoundingVolume& bounds, const Mat4& worldMatrix) const
+{
+    const BoundingVolume world = bounds.Transform(worldMatrix);
+
+    for (const float* const plane : planes)
+    {
+        const float distance = plane[0] * world.center[0] + plane[1] * world.center[1] + plane[2] * world.center[2] + plane[3];
+        if (distance < -world.radius) return false;
+
+        const float boxRadius = std::abs(plane[0]) * world.extents[0] + std::abs(plane[1]) * world.extents[1] + std::abs(plane[2]) * world.extents[2];
+        if (distance < -boxRadius) return false;
+    }
+
+    return true;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
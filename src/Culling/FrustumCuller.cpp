@@ -0,0 +1,312 @@
+/// @file    FrustumCuller.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 15:31:06
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Culling/FrustumCuller.hpp"
+
+#if defined(__AVX2__)
+    #define VELECS_CULL_AVX2
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VELECS_CULL_SSE2
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define VELECS_CULL_NEON
+    #include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace velecs::graphics {
+
+namespace {  // Anonymous namespace for private implementation
+
+#if defined(VELECS_CULL_AVX2)
+constexpr size_t LANE_COUNT = 8;
+#elif defined(VELECS_CULL_SSE2) || defined(VELECS_CULL_NEON)
+constexpr size_t LANE_COUNT = 4;
+#else
+constexpr size_t LANE_COUNT = 1;
+#endif
+
+/// @brief Structure of arrays view of the bounds, offset to the first object of a block.
+struct BoundsArrays {
+    const float* centerX;
+    const float* centerY;
+    const float* centerZ;
+    const float* radius;
+    const float* extentX;
+    const float* extentY;
+    const float* extentZ;
+};
+
+/// @brief Plane with the absolute value of its normal, used to project the box extents.
+struct CullPlane {
+    float normal[3];
+    float distance;
+    float absNormal[3];
+};
+
+/// @brief Tests one object with the same operations as the vector kernels.
+bool IsVisible(const CullPlane (&planes)[6], const BoundsArrays& bounds, const size_t i)
+{
+    for (const CullPlane& plane : planes)
+    {
+        const float distance = plane.normal[0] * bounds.centerX[i] + plane.normal[1] * bounds.centerY[i]
+            + (plane.normal[2] * bounds.centerZ[i] + plane.distance);
+        const float boxRadius = plane.absNormal[0] * bounds.extentX[i] + plane.absNormal[1] * bounds.extentY[i]
+            + plane.absNormal[2] * bounds.extentZ[i];
+
+        // Outside as soon as either volume is fully behind the plane
+        if (distance + std::min(bounds.radius[i], boxRadius) < 0.0f) return false;
+    }
+    return true;
+}
+
+#if defined(VELECS_CULL_AVX2)
+
+/// @brief Tests 8 objects, returns a bit per visible object.
+uint32_t TestBlock(const CullPlane (&planes)[6], const BoundsArrays& bounds, const size_t i)
+{
+    const __m256 cx = _mm256_loadu_ps(bounds.centerX + i);
+    const __m256 cy = _mm256_loadu_ps(bounds.centerY + i);
+    const __m256 cz = _mm256_loadu_ps(bounds.centerZ + i);
+    const __m256 r = _mm256_loadu_ps(bounds.radius + i);
+    const __m256 ex = _mm256_loadu_ps(bounds.extentX + i);
+    const __m256 ey = _mm256_loadu_ps(bounds.extentY + i);
+    const __m256 ez = _mm256_loadu_ps(bounds.extentZ + i);
+    const __m256 zero = _mm256_setzero_ps();
+
+    __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (const CullPlane& plane : planes)
+    {
+        const __m256 distance = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.normal[0]), cx), _mm256_mul_ps(_mm256_set1_ps(plane.normal[1]), cy)),
+            _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.normal[2]), cz), _mm256_set1_ps(plane.distance))
+        );
+        const __m256 boxRadius = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.absNormal[0]), ex), _mm256_mul_ps(_mm256_set1_ps(plane.absNormal[1]), ey)),
+            _mm256_mul_ps(_mm256_set1_ps(plane.absNormal[2]), ez)
+        );
+        const __m256 limit = _mm256_add_ps(distance, _mm256_min_ps(r, boxRadius));
+        visible = _mm256_and_ps(visible, _mm256_cmp_ps(limit, zero, _CMP_GE_OQ));
+    }
+    return static_cast<uint32_t>(_mm256_movemask_ps(visible));
+}
+
+#elif defined(VELECS_CULL_SSE2)
+
+/// @brief Tests 4 objects, returns a bit per visible object.
+uint32_t TestBlock(const CullPlane (&planes)[6], const BoundsArrays& bounds, const size_t i)
+{
+    const __m128 cx = _mm_loadu_ps(bounds.centerX + i);
+    const __m128 cy = _mm_loadu_ps(bounds.centerY + i);
+    const __m128 cz = _mm_loadu_ps(bounds.centerZ + i);
+    const __m128 r = _mm_loadu_ps(bounds.radius + i);
+    const __m128 ex = _mm_loadu_ps(bounds.extentX + i);
+    const __m128 ey = _mm_loadu_ps(bounds.extentY + i);
+    const __m128 ez = _mm_loadu_ps(bounds.extentZ + i);
+    const __m128 zero = _mm_setzero_ps();
+
+    __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (const CullPlane& plane : planes)
+    {
+        const __m128 distance = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal[0]), cx), _mm_mul_ps(_mm_set1_ps(plane.normal[1]), cy)),
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal[2]), cz), _mm_set1_ps(plane.distance))
+        );
+        const __m128 boxRadius = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.absNormal[0]), ex), _mm_mul_ps(_mm_set1_ps(plane.absNormal[1]), ey)),
+            _mm_mul_ps(_mm_set1_ps(plane.absNormal[2]), ez)
+        );
+        const __m128 limit = _mm_add_ps(distance, _mm_min_ps(r, boxRadius));
+        visible = _mm_and_ps(visible, _mm_cmpge_ps(limit, zero));
+    }
+    return static_cast<uint32_t>(_mm_movemask_ps(visible));
+}
+
+#elif defined(VELECS_CULL_NEON)
+
+/// @brief Tests 4 objects, returns a bit per visible object.
+uint32_t TestBlock(const CullPlane (&planes)[6], const BoundsArrays& bounds, const size_t i)
+{
+    const float32x4_t cx = vld1q_f32(bounds.centerX + i);
+    const float32x4_t cy = vld1q_f32(bounds.centerY + i);
+    const float32x4_t cz = vld1q_f32(bounds.centerZ + i);
+    const float32x4_t r = vld1q_f32(bounds.radius + i);
+    const float32x4_t ex = vld1q_f32(bounds.extentX + i);
+    const float32x4_t ey = vld1q_f32(bounds.extentY + i);
+    const float32x4_t ez = vld1q_f32(bounds.extentZ + i);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+
+    uint32x4_t visible = vdupq_n_u32(0xFFFFFFFFu);
+    for (const CullPlane& plane : planes)
+    {
+        const float32x4_t distance = vaddq_f32(
+            vaddq_f32(vmulq_n_f32(cx, plane.normal[0]), vmulq_n_f32(cy, plane.normal[1])),
+            vaddq_f32(vmulq_n_f32(cz, plane.normal[2]), vdupq_n_f32(plane.distance))
+        );
+        const float32x4_t boxRadius = vaddq_f32(
+            vaddq_f32(vmulq_n_f32(ex, plane.absNormal[0]), vmulq_n_f32(ey, plane.absNormal[1])),
+            vmulq_n_f32(ez, plane.absNormal[2])
+        );
+        const float32x4_t limit = vaddq_f32(distance, vminq_f32(r, boxRadius));
+        visible = vandq_u32(visible, vcgeq_f32(limit, zero));
+    }
+
+    const uint32_t laneBits[4]{1u, 2u, 4u, 8u};
+    const uint32x4_t bits = vandq_u32(visible, vld1q_u32(laneBits));
+    return vgetq_lane_u32(bits, 0) | vgetq_lane_u32(bits, 1) | vgetq_lane_u32(bits, 2) | vgetq_lane_u32(bits, 3);
+}
+
+#else
+
+/// @brief Tests 1 object, returns a bit set if it is visible.
+uint32_t TestBlock(const CullPlane (&planes)[6], const BoundsArrays& bounds, const size_t i)
+{
+    return IsVisible(planes, bounds, i) ? 1u : 0u;
+}
+
+#endif
+
+} // namespace
+
+// Public Fields
+
+const size_t FrustumCuller::MIN_OBJECTS_PER_TASK = 4096;
+
+// Constructors and Destructors
+
+// Public Methods
+
+void FrustumCuller::Resize(const size_t objectCount)
+{
+    _centerX.resize(objectCount);
+    _centerY.resize(objectCount);
+    _centerZ.resize(objectCount);
+    _radius.resize(objectCount);
+    _extentX.resize(objectCount);
+    _extentY.resize(objectCount);
+    _extentZ.resize(objectCount);
+}
+
+void FrustumCuller::SetBounds(const size_t index, const BoundingVolume& bounds, const Mat4& worldMatrix)
+{
+    const BoundingVolume world = bounds.Transform(worldMatrix);
+
+    _centerX[index] = world.center[0];
+    _centerY[index] = world.center[1];
+    _centerZ[index] = world.center[2];
+    _radius[index] = world.radius;
+    _extentX[index] = world.extents[0];
+    _extentY[index] = world.extents[1];
+    _extentZ[index] = world.extents[2];
+}
+
+const std::vector<uint32_t>& FrustumCuller::Cull(const Frustum& frustum, WorkerPool& workerPool)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    const size_t objectCount = GetObjectCount();
+    const size_t taskCount = std::min<size_t>(
+        workerPool.GetThreadCount() + 1,
+        (objectCount + MIN_OBJECTS_PER_TASK - 1) / MIN_OBJECTS_PER_TASK
+    );
+
+    // Chunks are whole blocks, so only the last one has a scalar tail
+    size_t objectsPerTask = taskCount > 0 ? (objectCount + taskCount - 1) / taskCount : 0;
+    objectsPerTask = (objectsPerTask + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+
+    if (_taskVisible.size() < taskCount) _taskVisible.resize(taskCount);
+
+    workerPool.ParallelFor(taskCount, [&](const size_t task) {
+        std::vector<uint32_t>& visible = _taskVisible[task];
+        visible.clear();
+
+        const size_t begin = std::min(objectCount, task * objectsPerTask);
+        const size_t end = std::min(objectCount, begin + objectsPerTask);
+        CullRange(frustum, begin, end, visible);
+    });
+
+    // Tasks cover consecutive ranges, so concatenating keeps the indices sorted
+    _visible.clear();
+    for (size_t task{0}; task < taskCount; ++task)
+    {
+        _visible.insert(_visible.end(), _taskVisible[task].begin(), _taskVisible[task].end());
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    _stats.objectCount = objectCount;
+    _stats.visibleCount = _visible.size();
+    _stats.taskCount = static_cast<uint32_t>(taskCount);
+    _stats.milliseconds = elapsed.count();
+
+    return _visible;
+}
+
+const char* FrustumCuller::GetKernelName()
+{
+#if defined(VELECS_CULL_AVX2)
+    return "AVX2";
+#elif defined(VELECS_CULL_SSE2)
+    return "SSE2";
+#elif defined(VELECS_CULL_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void FrustumCuller::CullRange(const Frustum& frustum, const size_t begin, const size_t end, std::vector<uint32_t>& visible) const
+{
+    CullPlane planes[6];
+    for (int p{0}; p < 6; ++p)
+    {
+        for (int c{0}; c < 3; ++c)
+        {
+            planes[p].normal[c] = frustum.planes[p][c];
+            planes[p].absNormal[c] = std::abs(frustum.planes[p][c]);
+        }
+        planes[p].distance = frustum.planes[p][3];
+    }
+
+    const BoundsArrays bounds{
+        _centerX.data(), _centerY.data(), _centerZ.data(), _radius.data(),
+        _extentX.data(), _extentY.data(), _extentZ.data()
+    };
+
+    size_t i{begin};
+    for (; i + LANE_COUNT <= end; i += LANE_COUNT)
+    {
+        const uint32_t mask = TestBlock(planes, bounds, i);
+        if (mask == 0) continue;
+
+        for (size_t lane{0}; lane < LANE_COUNT; ++lane)
+        {
+            if (mask & (1u << lane)) visible.push_back(static_cast<uint32_t>(i + lane));
+        }
+    }
+
+    for (; i < end; ++i)
+    {
+        if (IsVisible(planes, bounds, i)) visible.push_back(static_cast<uint32_t>(i));
+    }
+}
+
+} // namespace velecs::graphics
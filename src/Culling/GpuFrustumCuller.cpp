@@ -0,0 +1,100 @@
+/// @file    GpuFrustumCuller.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:52:19
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Culling/GpuFrustumCuller.hpp"
+
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+namespace velecs::graphics {
+
+static_assert(sizeof(FrustumCullPushConstant) == 128);
+
+// Public Fields
+
+const uint32_t GpuFrustumCuller::WORKGROUP_SIZE = 64;
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool GpuFrustumCuller::Init(
+    const VkDevice device,
+    PipelineCache* const pipelineCache /* = nullptr*/,
+    ShaderModuleCache* const shaderModuleCache /* = nullptr*/,
+    PipelineLayoutCache* const pipelineLayoutCache /* = nullptr*/
+)
+{
+    try
+    {
+        // Every buffer is reached through its device address, so no descriptor set is needed
+        auto program = std::make_unique<ComputeShaderProgram>();
+        program->SetComputeShader(ComputeShader::FromFile("internal/shaders/frustum_cull.comp.spv"));
+        program->ConfigurePushConstants<FrustumCullPushConstant>();
+        program->Init(device, pipelineCache, shaderModuleCache, pipelineLayoutCache);
+
+        _program = std::move(program);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to create frustum culling program: " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void GpuFrustumCuller::Cleanup()
+{
+    _program.reset();
+}
+
+void GpuFrustumCuller::Dispatch(const VkCommandBuffer cmd, const Frustum& frustum, const IndirectDrawBuffers& draws, const uint32_t drawCount)
+{
+    if (drawCount == 0) return;
+
+    FrustumCullPushConstant& pushConstant = _program->GetPushConstant<FrustumCullPushConstant>();
+    std::memcpy(pushConstant.planes, frustum.planes, sizeof(pushConstant.planes));
+    pushConstant.objectBuffer = draws.GetObjectBufferAddress();
+    pushConstant.commandBuffer = draws.GetCommandBufferAddress();
+    pushConstant.countBuffer = draws.GetCountBufferAddress();
+    pushConstant.drawCount = drawCount;
+    pushConstant.padding = 0;
+
+    _program->SetGroupCount((drawCount + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE);
+    _program->Dispatch(cmd);
+
+    // The counts and commands are consumed as indirect parameters
+    VkMemoryBarrier2 barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+    barrier.pNext = nullptr;
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
+
+    VkDependencyInfo depInfo{};
+    depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    depInfo.pNext = nullptr;
+    depInfo.memoryBarrierCount = 1;
+    depInfo.pMemoryBarriers = &barrier;
+    vkCmdPipelineBarrier2(cmd, &depInfo);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
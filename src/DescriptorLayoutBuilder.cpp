@@ -68,6 +68,16 @@ VkDescriptorSetLayout DescriptorLayoutBuilder::Build(
     return setLayout;
 }
 
+VkDescriptorSetLayout DescriptorLayoutBuilder::Build(PipelineLayoutCache& cache, const VkShaderStageFlags stageFlags)
+{
+    for (auto& binding : _bindings)
+    {
+        binding.stageFlags |= stageFlags;
+    }
+
+    return cache.GetDescriptorSetLayout(_bindings);
+}
+
 // Protected Fields
 
 // Protected Methods
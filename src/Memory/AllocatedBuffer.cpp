@@ -24,6 +24,7 @@ std::unique_ptr<AllocatedBuffer> AllocatedBuffer::TryCreateBuffer(const VmaAlloc
 {
     auto buffer = std::make_unique<AllocatedBuffer>(ConstructorKey{});
     buffer->_allocator = allocator;
+    buffer->_size = allocSize;
 
     VkBufferCreateInfo bufferInfo{};
     bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -52,6 +53,24 @@ std::unique_ptr<AllocatedBuffer> AllocatedBuffer::TryCreateBuffer(const VmaAlloc
     return buffer;
 }
 
+void AllocatedBuffer::Invalidate() const
+{
+    const VkResult result = vmaInvalidateAllocation(_allocator, _allocation, 0, VK_WHOLE_SIZE);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to invalidate buffer allocation: " << result << std::endl;
+    }
+}
+
+void AllocatedBuffer::Flush() const
+{
+    const VkResult result = vmaFlushAllocation(_allocator, _allocation, 0, VK_WHOLE_SIZE);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to flush buffer allocation: " << result << std::endl;
+    }
+}
+
 // Protected Fields
 
 // Protected Methods
@@ -69,6 +88,7 @@ void AllocatedBuffer::Cleanup()
         buffer = VK_NULL_HANDLE;
         _allocation = VK_NULL_HANDLE;
         _allocationInfo = {};
+        _size = 0;
     }
 }
 
@@ -0,0 +1,281 @@
+/// @file    BindlessHeap.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 17:58:03
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Memory/BindlessHeap.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace velecs::graphics {
+
+namespace {  // Anonymous namespace for private implementation
+
+/// @brief Descriptor type of each array, indexed by ResourceType.
+const VkDescriptorType DESCRIPTOR_TYPES[3]{
+    VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+    VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+};
+
+} // namespace
+
+// Public Fields
+
+const uint32_t BindlessHeap::INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+const uint32_t BindlessHeap::DEFAULT_SAMPLED_IMAGE_CAPACITY = 16384;
+const uint32_t BindlessHeap::DEFAULT_STORAGE_IMAGE_CAPACITY = 1024;
+const uint32_t BindlessHeap::DEFAULT_STORAGE_BUFFER_CAPACITY = 4096;
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool BindlessHeap::Init(
+    const VkDevice device,
+    const VkPhysicalDevice physicalDevice,
+    const uint32_t sampledImageCapacity /* = DEFAULT_SAMPLED_IMAGE_CAPACITY*/,
+    const uint32_t storageImageCapacity /* = DEFAULT_STORAGE_IMAGE_CAPACITY*/,
+    const uint32_t storageBufferCapacity /* = DEFAULT_STORAGE_BUFFER_CAPACITY*/
+)
+{
+    _device = device;
+
+    VkPhysicalDeviceVulkan12Properties properties12{};
+    properties12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties{};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties.pNext = &properties12;
+    vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+    // Every binding is visible to all stages, so the per-stage limits apply to the whole heap
+    uint32_t capacities[3]{
+        std::min({
+            sampledImageCapacity,
+            properties12.maxDescriptorSetUpdateAfterBindSampledImages,
+            properties12.maxPerStageDescriptorUpdateAfterBindSampledImages,
+            properties12.maxDescriptorSetUpdateAfterBindSamplers,
+            properties12.maxPerStageDescriptorUpdateAfterBindSamplers
+        }),
+        std::min({
+            storageImageCapacity,
+            properties12.maxDescriptorSetUpdateAfterBindStorageImages,
+            properties12.maxPerStageDescriptorUpdateAfterBindStorageImages
+        }),
+        std::min({
+            storageBufferCapacity,
+            properties12.maxDescriptorSetUpdateAfterBindStorageBuffers,
+            properties12.maxPerStageDescriptorUpdateAfterBindStorageBuffers
+        })
+    };
+    while (static_cast<uint64_t>(capacities[0]) + capacities[1] + capacities[2] > properties12.maxPerStageUpdateAfterBindResources)
+    {
+        for (uint32_t& capacity : capacities) capacity /= 2;
+    }
+
+    VkDescriptorSetLayoutBinding bindings[3]{};
+    VkDescriptorBindingFlags bindingFlags[3]{};
+    VkDescriptorPoolSize poolSizes[3]{};
+    for (uint32_t i{0}; i < 3; ++i)
+    {
+        _slots[i] = Slots{};
+        _slots[i].capacity = capacities[i];
+
+        bindings[i].binding = i;
+        bindings[i].descriptorType = DESCRIPTOR_TYPES[i];
+        bindings[i].descriptorCount = std::max(capacities[i], 1u);
+        bindings[i].stageFlags = VK_SHADER_STAGE_ALL;
+
+        // Unregistered elements stay empty, and registering one never disturbs frames in flight
+        bindingFlags[i] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+            | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT
+            | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+
+        poolSizes[i].type = DESCRIPTOR_TYPES[i];
+        poolSizes[i].descriptorCount = bindings[i].descriptorCount;
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+    bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    bindingFlagsInfo.pNext = nullptr;
+    bindingFlagsInfo.bindingCount = 3;
+    bindingFlagsInfo.pBindingFlags = bindingFlags;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.pNext = &bindingFlagsInfo;
+    layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    layoutInfo.bindingCount = 3;
+    layoutInfo.pBindings = bindings;
+
+    VkResult result = vkCreateDescriptorSetLayout(_device, &layoutInfo, nullptr, &_descriptorSetLayout);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create bindless descriptor set layout: " << result << std::endl;
+        return false;
+    }
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.pNext = nullptr;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    poolInfo.maxSets = 1;
+    poolInfo.poolSizeCount = 3;
+    poolInfo.pPoolSizes = poolSizes;
+
+    result = vkCreateDescriptorPool(_device, &poolInfo, nullptr, &_pool);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create bindless descriptor pool: " << result << std::endl;
+        return false;
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.pNext = nullptr;
+    allocInfo.descriptorPool = _pool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &_descriptorSetLayout;
+
+    result = vkAllocateDescriptorSets(_device, &allocInfo, &_descriptorSet);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to allocate bindless descriptor set: " << result << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void BindlessHeap::Cleanup()
+{
+    if (_pool != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorPool(_device, _pool, nullptr);
+        _pool = VK_NULL_HANDLE;
+    }
+
+    if (_descriptorSetLayout != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorSetLayout(_device, _descriptorSetLayout, nullptr);
+        _descriptorSetLayout = VK_NULL_HANDLE;
+    }
+
+    _descriptorSet = VK_NULL_HANDLE;
+    for (Slots& slots : _slots) slots = Slots{};
+}
+
+uint32_t BindlessHeap::RegisterSampledImage(
+    const VkImageView imageView,
+    const VkSampler sampler,
+    const VkImageLayout imageLayout /* = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL*/
+)
+{
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = sampler;
+    imageInfo.imageView = imageView;
+    imageInfo.imageLayout = imageLayout;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    const uint32_t index = AllocateSlot(ResourceType::SampledImage);
+    if (index != INVALID_INDEX) WriteDescriptor(ResourceType::SampledImage, index, &imageInfo, nullptr);
+    return index;
+}
+
+uint32_t BindlessHeap::RegisterStorageImage(const VkImageView imageView)
+{
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = VK_NULL_HANDLE;
+    imageInfo.imageView = imageView;
+    imageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    const uint32_t index = AllocateSlot(ResourceType::StorageImage);
+    if (index != INVALID_INDEX) WriteDescriptor(ResourceType::StorageImage, index, &imageInfo, nullptr);
+    return index;
+}
+
+uint32_t BindlessHeap::RegisterStorageBuffer(const VkBuffer buffer, const VkDeviceSize offset /* = 0*/, const VkDeviceSize range /* = VK_WHOLE_SIZE*/)
+{
+    VkDescriptorBufferInfo bufferInfo{};
+    bufferInfo.buffer = buffer;
+    bufferInfo.offset = offset;
+    bufferInfo.range = range;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    const uint32_t index = AllocateSlot(ResourceType::StorageBuffer);
+    if (index != INVALID_INDEX) WriteDescriptor(ResourceType::StorageBuffer, index, nullptr, &bufferInfo);
+    return index;
+}
+
+void BindlessHeap::Free(const ResourceType type, const uint32_t index)
+{
+    if (index == INVALID_INDEX) return;
+
+    // The stale descriptor stays in place, partially bound arrays allow it as long as shaders stop reading it
+    std::lock_guard<std::mutex> lock(_mutex);
+    _slots[static_cast<size_t>(type)].free.push_back(index);
+}
+
+void BindlessHeap::Bind(const VkCommandBuffer cmd, const VkPipelineBindPoint bindPoint, const VkPipelineLayout layout, const uint32_t setIndex /* = 0*/) const
+{
+    vkCmdBindDescriptorSets(cmd, bindPoint, layout, setIndex, 1, &_descriptorSet, 0, nullptr);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+uint32_t BindlessHeap::AllocateSlot(const ResourceType type)
+{
+    Slots& slots = _slots[static_cast<size_t>(type)];
+    if (!slots.free.empty())
+    {
+        const uint32_t index = slots.free.back();
+        slots.free.pop_back();
+        return index;
+    }
+
+    if (slots.next >= slots.capacity)
+    {
+        std::cerr << "Failed to register bindless resource: the array of type " << static_cast<int>(type) << " is full." << std::endl;
+        return INVALID_INDEX;
+    }
+
+    return slots.next++;
+}
+
+void BindlessHeap::WriteDescriptor(
+    const ResourceType type,
+    const uint32_t index,
+    const VkDescriptorImageInfo* const imageInfo,
+    const VkDescriptorBufferInfo* const bufferInfo
+)
+{
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.pNext = nullptr;
+    write.dstSet = _descriptorSet;
+    write.dstBinding = static_cast<uint32_t>(type);
+    write.dstArrayElement = index;
+    write.descriptorCount = 1;
+    write.descriptorType = DESCRIPTOR_TYPES[static_cast<size_t>(type)];
+    write.pImageInfo = imageInfo;
+    write.pBufferInfo = bufferInfo;
+
+    vkUpdateDescriptorSets(_device, 1, &write, 0, nullptr);
+}
+
+} // namespace velecs::graphics
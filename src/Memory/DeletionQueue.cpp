@@ -23,8 +23,32 @@ void DeletionQueue::PushDeleter(std::function<void()>&& deleter)
     _deleters.push_back(std::move(deleter));
 }
 
+void DeletionQueue::PushDeleter(std::function<void()>&& deleter, const uint64_t value)
+{
+    _pendingDeleters.emplace_back(value, std::move(deleter));
+}
+
+void DeletionQueue::Retire(const uint64_t completedValue)
+{
+    // Values never decrease, so the reached ones are at the front
+    while (!_pendingDeleters.empty() && _pendingDeleters.front().first <= completedValue)
+    {
+        // Popped before calling so a deleter pushing another one cannot invalidate it
+        std::function<void()> deleter = std::move(_pendingDeleters.front().second);
+        _pendingDeleters.pop_front();
+        deleter();
+    }
+}
+
 void DeletionQueue::Flush()
 {
+    // Only called once the GPU is idle, so every pending deleter can run
+    for (auto it = _pendingDeleters.rbegin(); it != _pendingDeleters.rend(); it++)
+    {
+        it->second();
+    }
+    _pendingDeleters.clear();
+
     // Reverse iterate the deletion queue to execute all the functions
     for (auto it = _deleters.rbegin(); it != _deleters.rend(); it++)
     {
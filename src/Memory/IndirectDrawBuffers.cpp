@@ -0,0 +1,122 @@
+/// @file    IndirectDrawBuffers.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:31:08
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Memory/IndirectDrawBuffers.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+const size_t IndirectDrawBuffers::MIN_DRAW_CAPACITY = 1024;
+const size_t IndirectDrawBuffers::MIN_BUCKET_CAPACITY = 64;
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool IndirectDrawBuffers::Reserve(const VkDevice device, const VmaAllocator allocator, const size_t drawCount, const size_t bucketCount)
+{
+    if (drawCount > _drawCapacity)
+    {
+        size_t capacity = std::max(_drawCapacity, MIN_DRAW_CAPACITY);
+        while (capacity < drawCount) capacity *= 2;
+
+        // Written by the host every frame and read once by the GPU, so host visible memory is enough
+        _objectBuffer = AllocatedBuffer::TryCreateBuffer(
+            allocator,
+            capacity * sizeof(ObjectData),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            VMA_MEMORY_USAGE_CPU_TO_GPU
+        );
+        _commandBuffer = AllocatedBuffer::TryCreateBuffer(
+            allocator,
+            capacity * sizeof(VkDrawIndexedIndirectCommand),
+            VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            VMA_MEMORY_USAGE_CPU_TO_GPU
+        );
+        if (!_objectBuffer || !_commandBuffer)
+        {
+            std::cerr << "Failed to create indirect draw buffers." << std::endl;
+            Cleanup();
+            return false;
+        }
+
+        _objectBufferAddress = GetBufferAddress(device, _objectBuffer->buffer);
+        _commandBufferAddress = GetBufferAddress(device, _commandBuffer->buffer);
+
+        _drawCapacity = capacity;
+    }
+
+    if (bucketCount > _bucketCapacity)
+    {
+        size_t capacity = std::max(_bucketCapacity, MIN_BUCKET_CAPACITY);
+        while (capacity < bucketCount) capacity *= 2;
+
+        _countBuffer = AllocatedBuffer::TryCreateBuffer(
+            allocator,
+            capacity * sizeof(uint32_t),
+            VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            VMA_MEMORY_USAGE_CPU_TO_GPU
+        );
+        if (!_countBuffer)
+        {
+            std::cerr << "Failed to create indirect count buffer." << std::endl;
+            Cleanup();
+            return false;
+        }
+
+        _countBufferAddress = GetBufferAddress(device, _countBuffer->buffer);
+
+        _bucketCapacity = capacity;
+    }
+
+    return true;
+}
+
+void IndirectDrawBuffers::Flush() const
+{
+    if (_objectBuffer) _objectBuffer->Flush();
+    if (_commandBuffer) _commandBuffer->Flush();
+    if (_countBuffer) _countBuffer->Flush();
+}
+
+void IndirectDrawBuffers::Cleanup()
+{
+    _objectBuffer.reset();
+    _commandBuffer.reset();
+    _countBuffer.reset();
+    _objectBufferAddress = 0;
+    _commandBufferAddress = 0;
+    _countBufferAddress = 0;
+    _drawCapacity = 0;
+    _bucketCapacity = 0;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+VkDeviceAddress IndirectDrawBuffers::GetBufferAddress(const VkDevice device, const VkBuffer buffer)
+{
+    VkBufferDeviceAddressInfo deviceAddressInfo{};
+    deviceAddressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+    deviceAddressInfo.pNext = nullptr;
+    deviceAddressInfo.buffer = buffer;
+    return vkGetBufferDeviceAddress(device, &deviceAddressInfo);
+}
+
+} // namespace velecs::graphics
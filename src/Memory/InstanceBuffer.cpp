@@ -0,0 +1,77 @@
+/// @file    InstanceBuffer.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 16:47:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Memory/InstanceBuffer.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+const size_t InstanceBuffer::MIN_INSTANCE_CAPACITY = 1024;
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool InstanceBuffer::Reserve(const VkDevice device, const VmaAllocator allocator, const size_t instanceCount)
+{
+    if (instanceCount <= _capacity) return true;
+
+    size_t capacity = std::max(_capacity, MIN_INSTANCE_CAPACITY);
+    while (capacity < instanceCount) capacity *= 2;
+
+    // Written by the host every frame and read once by the GPU, so host visible memory is enough
+    _buffer = AllocatedBuffer::TryCreateBuffer(
+        allocator,
+        capacity * sizeof(ObjectData),
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+        VMA_MEMORY_USAGE_CPU_TO_GPU
+    );
+    if (!_buffer)
+    {
+        std::cerr << "Failed to create instance buffer." << std::endl;
+        Cleanup();
+        return false;
+    }
+
+    VkBufferDeviceAddressInfo deviceAddressInfo{};
+    deviceAddressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+    deviceAddressInfo.pNext = nullptr;
+    deviceAddressInfo.buffer = _buffer->buffer;
+    _bufferAddress = vkGetBufferDeviceAddress(device, &deviceAddressInfo);
+
+    _capacity = capacity;
+    return true;
+}
+
+void InstanceBuffer::Flush() const
+{
+    if (_buffer) _buffer->Flush();
+}
+
+void InstanceBuffer::Cleanup()
+{
+    _buffer.reset();
+    _bufferAddress = 0;
+    _capacity = 0;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
@@ -0,0 +1,152 @@
+/// @file    UniformRingAllocator.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 17:22:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Memory/UniformRingAllocator.hpp"
+
+#include "velecs/graphics/DescriptorLayoutBuilder.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool UniformRingAllocator::Init(
+    const VkDevice device,
+    const VkPhysicalDevice physicalDevice,
+    const VmaAllocator allocator,
+    DescriptorAllocator& descriptorAllocator,
+    const uint32_t frameCount,
+    const VkDeviceSize bytesPerFrame,
+    const VkDeviceSize blockSize,
+    const VkShaderStageFlags stages /* = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT*/
+)
+{
+    _device = device;
+
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    _alignment = std::max<VkDeviceSize>(properties.limits.minUniformBufferOffsetAlignment, 1);
+
+    if (blockSize == 0 || blockSize > properties.limits.maxUniformBufferRange)
+    {
+        std::cerr << "Failed to create uniform ring: block size " << blockSize << " is outside the device's uniform buffer range." << std::endl;
+        return false;
+    }
+
+    // Regions start aligned, so every block offset is aligned in the whole buffer
+    _blockSize = blockSize;
+    _bytesPerFrame = (std::max(bytesPerFrame, blockSize) + _alignment - 1) / _alignment * _alignment;
+
+    _buffer = AllocatedBuffer::TryCreateBuffer(
+        allocator,
+        _bytesPerFrame * frameCount,
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+        VMA_MEMORY_USAGE_CPU_TO_GPU
+    );
+    if (!_buffer)
+    {
+        std::cerr << "Failed to create uniform ring buffer." << std::endl;
+        return false;
+    }
+
+    _descriptorSetLayout = DescriptorLayoutBuilder{}
+        .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+        .Build(_device, stages)
+        ;
+
+    _descriptorSet = descriptorAllocator.Allocate(_device, _descriptorSetLayout);
+
+    // The descriptor covers one block at the start of the buffer, dynamic offsets move it onto each block
+    VkDescriptorBufferInfo bufferInfo{};
+    bufferInfo.buffer = _buffer->buffer;
+    bufferInfo.offset = 0;
+    bufferInfo.range = _blockSize;
+
+    VkWriteDescriptorSet descriptorWrite{};
+    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptorWrite.pNext = nullptr;
+    descriptorWrite.dstSet = _descriptorSet;
+    descriptorWrite.dstBinding = 0;
+    descriptorWrite.dstArrayElement = 0;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    descriptorWrite.descriptorCount = 1;
+    descriptorWrite.pBufferInfo = &bufferInfo;
+
+    vkUpdateDescriptorSets(_device, 1, &descriptorWrite, 0, nullptr);
+
+    return true;
+}
+
+void UniformRingAllocator::Cleanup()
+{
+    if (_descriptorSetLayout != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorSetLayout(_device, _descriptorSetLayout, nullptr);
+        _descriptorSetLayout = VK_NULL_HANDLE;
+    }
+
+    _buffer.reset();
+    _descriptorSet = VK_NULL_HANDLE;
+    _regionOffset = 0;
+    _head.store(0, std::memory_order_relaxed);
+}
+
+void UniformRingAllocator::BeginFrame(const uint32_t frameIndex)
+{
+    _regionOffset = _bytesPerFrame * frameIndex;
+    _head.store(0, std::memory_order_relaxed);
+}
+
+void* UniformRingAllocator::Allocate(const VkDeviceSize size, uint32_t& dynamicOffset)
+{
+    if (size == 0 || size > _blockSize) return nullptr;
+
+    // Every block takes whole alignment units, so bumping the head keeps the next one aligned
+    const VkDeviceSize alignedSize = (size + _alignment - 1) / _alignment * _alignment;
+    const VkDeviceSize offset = _head.fetch_add(alignedSize, std::memory_order_relaxed);
+
+    // The descriptor reads a whole block, so it must fit in the region too
+    if (offset + std::max(alignedSize, _blockSize) > _bytesPerFrame) return nullptr;
+
+    dynamicOffset = static_cast<uint32_t>(_regionOffset + offset);
+    return static_cast<uint8_t*>(_buffer->GetMappedData()) + _regionOffset + offset;
+}
+
+void UniformRingAllocator::Flush() const
+{
+    if (_buffer) _buffer->Flush();
+}
+
+void UniformRingAllocator::Bind(
+    const VkCommandBuffer cmd,
+    const VkPipelineBindPoint bindPoint,
+    const VkPipelineLayout layout,
+    const uint32_t setIndex,
+    const uint32_t dynamicOffset
+) const
+{
+    vkCmdBindDescriptorSets(cmd, bindPoint, layout, setIndex, 1, &_descriptorSet, 1, &dynamicOffset);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
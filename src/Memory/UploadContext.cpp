@@ -0,0 +1,548 @@
+/// @file    UploadContext.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:02:31
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Memory/UploadContext.hpp"
+
+#include "velecs/graphics/VulkanInitializers.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+const VkDeviceSize UploadContext::STAGING_PAGE_SIZE = 16 * 1024 * 1024;
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool UploadContext::Init(
+    const VkDevice device,
+    const VmaAllocator allocator,
+    const VkQueue queue,
+    const uint32_t queueFamily,
+    const uint32_t graphicsQueueFamily
+)
+{
+    _device = device;
+    _allocator = allocator;
+    _queue = queue;
+    _queueFamily = queueFamily;
+    _graphicsQueueFamily = graphicsQueueFamily;
+
+    // Batches are recorded once and their command buffers reused after completion
+    VkCommandPoolCreateInfo commandPoolCreateInfo = VkExtCommandPoolCreateInfo(
+        _queueFamily,
+        VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT
+    );
+
+    VkResult result = vkCreateCommandPool(_device, &commandPoolCreateInfo, nullptr, &_commandPool);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create upload command pool: " << result << std::endl;
+        return false;
+    }
+
+    VkSemaphoreTypeCreateInfo semaphoreTypeInfo = VkExtSemaphoreTypeCreateInfo(VK_SEMAPHORE_TYPE_TIMELINE);
+
+    VkSemaphoreCreateInfo semaphoreCreateInfo = VkExtSemaphoreCreateInfo();
+    semaphoreCreateInfo.pNext = &semaphoreTypeInfo;
+
+    result = vkCreateSemaphore(_device, &semaphoreCreateInfo, nullptr, &_timelineSemaphore);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create upload timeline semaphore: " << result << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void UploadContext::Cleanup()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _openBatch.reset();
+    _submittedBatches.clear();
+    _freePages.clear();
+    _freeCommandBuffers.clear();
+    _failedValues.clear();
+
+    if (_device == VK_NULL_HANDLE) return;
+
+    // Destroying the pool frees every command buffer allocated from it
+    if (_commandPool != VK_NULL_HANDLE) vkDestroyCommandPool(_device, _commandPool, nullptr);
+    if (_timelineSemaphore != VK_NULL_HANDLE) vkDestroySemaphore(_device, _timelineSemaphore, nullptr);
+
+    _commandPool = VK_NULL_HANDLE;
+    _timelineSemaphore = VK_NULL_HANDLE;
+    _device = VK_NULL_HANDLE;
+}
+
+UploadTicket UploadContext::UploadBuffer(
+    const AllocatedBuffer& destination,
+    const void* const data,
+    const VkDeviceSize size,
+    const VkDeviceSize dstOffset /* = 0*/
+)
+{
+    if (size == 0) return UploadTicket{};
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Batch* const batch = GetOpenBatch();
+    if (batch == nullptr) return UploadTicket{};
+
+    VkBuffer stagingBuffer{VK_NULL_HANDLE};
+    VkDeviceSize stagingOffset{0};
+    void* mapped{nullptr};
+    if (!AllocateStaging(*batch, size, stagingBuffer, stagingOffset, mapped)) return UploadTicket{};
+
+    memcpy(mapped, data, static_cast<size_t>(size));
+
+    VkBufferCopy copy{};
+    copy.srcOffset = stagingOffset;
+    copy.dstOffset = dstOffset;
+    copy.size = size;
+    vkCmdCopyBuffer(batch->cmd, stagingBuffer, destination.buffer, 1, &copy);
+
+    if (IsTransferQueueSeparate())
+    {
+        // Exclusive buffers must be handed over to the graphics queue family
+        VkBufferMemoryBarrier2 barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+        barrier.pNext = nullptr;
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+        barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_NONE;
+        barrier.dstAccessMask = VK_ACCESS_2_NONE;
+        barrier.srcQueueFamilyIndex = _queueFamily;
+        barrier.dstQueueFamilyIndex = _graphicsQueueFamily;
+        barrier.buffer = destination.buffer;
+        barrier.offset = dstOffset;
+        barrier.size = size;
+
+        VkDependencyInfo depInfo{};
+        depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        depInfo.pNext = nullptr;
+        depInfo.bufferMemoryBarrierCount = 1;
+        depInfo.pBufferMemoryBarriers = &barrier;
+        vkCmdPipelineBarrier2(batch->cmd, &depInfo);
+
+        // The acquire mirrors the release, but waits instead of making writes available
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_NONE;
+        barrier.srcAccessMask = VK_ACCESS_2_NONE;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT;
+        batch->bufferAcquires.push_back(barrier);
+    }
+
+    return UploadTicket{batch->value};
+}
+
+UploadTicket UploadContext::UploadImage(
+    AllocatedImage& destination,
+    const void* const data,
+    const VkDeviceSize size,
+    const ImageUsage finalUsage /* = ImageUsage::FragmentSampledRead*/
+)
+{
+    if (size == 0) return UploadTicket{};
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Batch* const batch = GetOpenBatch();
+    if (batch == nullptr) return UploadTicket{};
+
+    VkBuffer stagingBuffer{VK_NULL_HANDLE};
+    VkDeviceSize stagingOffset{0};
+    void* mapped{nullptr};
+    if (!AllocateStaging(*batch, size, stagingBuffer, stagingOffset, mapped)) return UploadTicket{};
+
+    memcpy(mapped, data, static_cast<size_t>(size));
+
+    const ImageState finalState = ImageState::FromUsage(finalUsage);
+
+    VkImageMemoryBarrier2 barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    barrier.pNext = nullptr;
+    barrier.image = destination.image;
+    barrier.subresourceRange = VkExtImageSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT);
+
+    VkDependencyInfo depInfo{};
+    depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    depInfo.pNext = nullptr;
+    depInfo.imageMemoryBarrierCount = 1;
+    depInfo.pImageMemoryBarriers = &barrier;
+
+    // The whole image is overwritten, so its previous contents and owner do not matter
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_NONE;
+    barrier.srcAccessMask = VK_ACCESS_2_NONE;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    vkCmdPipelineBarrier2(batch->cmd, &depInfo);
+
+    VkBufferImageCopy copy{};
+    copy.bufferOffset = stagingOffset;
+    copy.bufferRowLength = 0;
+    copy.bufferImageHeight = 0;
+    copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copy.imageSubresource.mipLevel = 0;
+    copy.imageSubresource.baseArrayLayer = 0;
+    copy.imageSubresource.layerCount = 1;
+    copy.imageExtent = destination.imageExtent;
+    vkCmdCopyBufferToImage(batch->cmd, stagingBuffer, destination.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy);
+
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = finalState.layout;
+
+    if (IsTransferQueueSeparate())
+    {
+        // Release to the graphics queue family, the layout transition is part of the transfer
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_NONE;
+        barrier.dstAccessMask = VK_ACCESS_2_NONE;
+        barrier.srcQueueFamilyIndex = _queueFamily;
+        barrier.dstQueueFamilyIndex = _graphicsQueueFamily;
+        vkCmdPipelineBarrier2(batch->cmd, &depInfo);
+
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_NONE;
+        barrier.srcAccessMask = VK_ACCESS_2_NONE;
+        barrier.dstStageMask = finalState.stages;
+        barrier.dstAccessMask = finalState.accesses;
+        batch->imageAcquires.push_back(barrier);
+    }
+    else
+    {
+        // Same queue as rendering, later submissions are covered by this barrier
+        barrier.dstStageMask = finalState.stages;
+        barrier.dstAccessMask = finalState.accesses;
+        vkCmdPipelineBarrier2(batch->cmd, &depInfo);
+    }
+
+    batch->acquiredImages.emplace_back(&destination.state, finalUsage);
+
+    return UploadTicket{batch->value};
+}
+
+UploadTicket UploadContext::Record(std::function<void(VkCommandBuffer)>&& function)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Batch* const batch = GetOpenBatch();
+    if (batch == nullptr) return UploadTicket{};
+
+    function(batch->cmd);
+
+    return UploadTicket{batch->value};
+}
+
+UploadTicket UploadContext::Submit()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_openBatch) return UploadTicket{};
+
+    Batch& batch = *_openBatch;
+
+    if (!IsTransferQueueSeparate())
+    {
+        // Make the copies visible to everything submitted after the batch on the same queue
+        VkMemoryBarrier2 barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+        barrier.pNext = nullptr;
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+        barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT;
+
+        VkDependencyInfo depInfo{};
+        depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        depInfo.pNext = nullptr;
+        depInfo.memoryBarrierCount = 1;
+        depInfo.pMemoryBarriers = &barrier;
+        vkCmdPipelineBarrier2(batch.cmd, &depInfo);
+    }
+
+    // Staging memory may not be host coherent
+    for (const StagingPage& page : batch.pages)
+    {
+        page.buffer->Flush();
+    }
+
+    VkResult result = vkEndCommandBuffer(batch.cmd);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to end upload command buffer recording: " << result << std::endl;
+        DiscardOpenBatch();
+        return UploadTicket{};
+    }
+
+    VkCommandBufferSubmitInfo cmdInfo = VkExtCommandBufferSubmitInfo(batch.cmd);
+    VkSemaphoreSubmitInfo signalInfo = VkExtSemaphoreSubmitInfo(
+        VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        _timelineSemaphore,
+        batch.value
+    );
+    VkSubmitInfo2 submit = VkExtSubmitInfo2(&cmdInfo, &signalInfo, nullptr);
+
+    result = vkQueueSubmit2(_queue, 1, &submit, VK_NULL_HANDLE);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to submit uploads: " << result << std::endl;
+        DiscardOpenBatch();
+        return UploadTicket{};
+    }
+
+    const UploadTicket ticket{batch.value};
+    _submittedBatches.push_back(std::move(_openBatch));
+    return ticket;
+}
+
+bool UploadContext::IsComplete(const UploadTicket ticket) const
+{
+    if (IsFailed(ticket)) return false;
+    return ticket.value <= GetCompletedValue();
+}
+
+bool UploadContext::IsReady(const UploadTicket ticket) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return ticket.value <= _acquiredValue && !IsFailedValue(ticket.value);
+}
+
+bool UploadContext::IsFailed(const UploadTicket ticket) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return IsFailedValue(ticket.value);
+}
+
+bool UploadContext::Wait(const UploadTicket ticket, const uint64_t timeout /* = UINT64_MAX*/) const
+{
+    if (!ticket.IsValid()) return true;
+
+    // A later batch signals a higher value, waiting on it would report the discarded copies as done
+    if (IsFailed(ticket)) return false;
+
+    VkSemaphoreWaitInfo waitInfo{};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.pNext = nullptr;
+    waitInfo.flags = 0;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &_timelineSemaphore;
+    waitInfo.pValues = &ticket.value;
+
+    const VkResult result = vkWaitSemaphores(_device, &waitInfo, timeout);
+    if (result != VK_SUCCESS && result != VK_TIMEOUT)
+    {
+        std::cerr << "Failed to wait for uploads: " << result << std::endl;
+    }
+
+    return result == VK_SUCCESS;
+}
+
+uint64_t UploadContext::RecordAcquires(const VkCommandBuffer cmd)
+{
+    const uint64_t completedValue = GetCompletedValue();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::vector<VkBufferMemoryBarrier2> bufferAcquires;
+    std::vector<VkImageMemoryBarrier2> imageAcquires;
+    uint64_t waitValue{0};
+
+    // Batches complete in submission order
+    while (!_submittedBatches.empty() && _submittedBatches.front()->value <= completedValue)
+    {
+        std::unique_ptr<Batch> batch = std::move(_submittedBatches.front());
+        _submittedBatches.pop_front();
+
+        bufferAcquires.insert(bufferAcquires.end(), batch->bufferAcquires.begin(), batch->bufferAcquires.end());
+        imageAcquires.insert(imageAcquires.end(), batch->imageAcquires.begin(), batch->imageAcquires.end());
+
+        // Render graph barriers continue from the state the upload left the image in
+        for (const auto& [state, usage] : batch->acquiredImages)
+        {
+            *state = ImageState::FromUsage(usage);
+        }
+
+        for (StagingPage& page : batch->pages)
+        {
+            page.offset = 0;
+            _freePages.push_back(std::move(page));
+        }
+        _freeCommandBuffers.push_back(batch->cmd);
+
+        waitValue = batch->value;
+        _acquiredValue = batch->value;
+    }
+
+    if (bufferAcquires.empty() && imageAcquires.empty()) return 0;
+
+    VkDependencyInfo depInfo{};
+    depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    depInfo.pNext = nullptr;
+    depInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferAcquires.size());
+    depInfo.pBufferMemoryBarriers = bufferAcquires.data();
+    depInfo.imageMemoryBarrierCount = static_cast<uint32_t>(imageAcquires.size());
+    depInfo.pImageMemoryBarriers = imageAcquires.data();
+    vkCmdPipelineBarrier2(cmd, &depInfo);
+
+    // The batch already completed, the wait only orders the acquires after the releases
+    return waitValue;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+UploadContext::Batch* UploadContext::GetOpenBatch()
+{
+    if (_openBatch) return _openBatch.get();
+
+    auto batch = std::make_unique<Batch>();
+    batch->value = _nextValue;
+
+    if (!_freeCommandBuffers.empty())
+    {
+        batch->cmd = _freeCommandBuffers.back();
+        _freeCommandBuffers.pop_back();
+
+        VkResult result = vkResetCommandBuffer(batch->cmd, 0);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to reset upload command buffer: " << result << std::endl;
+            vkFreeCommandBuffers(_device, _commandPool, 1, &batch->cmd);
+            return nullptr;
+        }
+    }
+    else
+    {
+        VkCommandBufferAllocateInfo cmdAllocInfo = VkExtCommandBufferAllocateInfo(_commandPool, 1, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+        VkResult result = vkAllocateCommandBuffers(_device, &cmdAllocInfo, &batch->cmd);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to allocate upload command buffer: " << result << std::endl;
+            return nullptr;
+        }
+    }
+
+    VkCommandBufferBeginInfo cmdBeginInfo = VkExtCommandBufferBeginInfo(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
+    VkResult result = vkBeginCommandBuffer(batch->cmd, &cmdBeginInfo);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to begin upload command buffer recording: " << result << std::endl;
+        _freeCommandBuffers.push_back(batch->cmd);
+        return nullptr;
+    }
+
+    ++_nextValue;
+    _openBatch = std::move(batch);
+    return _openBatch.get();
+}
+
+void UploadContext::DiscardOpenBatch()
+{
+    // Never executed, so the staging pages can be reused right away. The command buffer
+    // state after a failed end or submission is unknown, it is freed rather than recycled
+    for (StagingPage& page : _openBatch->pages)
+    {
+        page.offset = 0;
+        _freePages.push_back(std::move(page));
+    }
+    vkFreeCommandBuffers(_device, _commandPool, 1, &_openBatch->cmd);
+
+    // Later batches signal higher values, so the tickets of this one must be told apart
+    _failedValues.push_back(_openBatch->value);
+    _openBatch.reset();
+}
+
+bool UploadContext::AllocateStaging(Batch& batch, const VkDeviceSize size, VkBuffer& buffer, VkDeviceSize& offset, void*& mapped)
+{
+    // Satisfies the offset alignment of buffer to image copies for every format
+    const VkDeviceSize alignment = 16;
+
+    auto tryPage = [&](StagingPage& page) {
+        const VkDeviceSize alignedOffset = (page.offset + alignment - 1) & ~(alignment - 1);
+        if (alignedOffset + size > page.buffer->GetSize()) return false;
+
+        buffer = page.buffer->buffer;
+        offset = alignedOffset;
+        mapped = static_cast<uint8_t*>(page.buffer->GetMappedData()) + alignedOffset;
+        page.offset = alignedOffset + size;
+        return true;
+    };
+
+    if (!batch.pages.empty() && tryPage(batch.pages.back())) return true;
+
+    // Reuse the smallest recycled page that fits
+    auto best = _freePages.end();
+    for (auto it = _freePages.begin(); it != _freePages.end(); ++it)
+    {
+        if (it->buffer->GetSize() < size) continue;
+        if (best == _freePages.end() || it->buffer->GetSize() < best->buffer->GetSize()) best = it;
+    }
+
+    if (best != _freePages.end())
+    {
+        batch.pages.push_back(std::move(*best));
+        _freePages.erase(best);
+        return tryPage(batch.pages.back());
+    }
+
+    StagingPage page{};
+    page.buffer = AllocatedBuffer::TryCreateBuffer(
+        _allocator,
+        static_cast<size_t>(std::max(size, STAGING_PAGE_SIZE)),
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VMA_MEMORY_USAGE_CPU_ONLY
+    );
+    if (!page.buffer)
+    {
+        std::cerr << "Failed to create staging buffer." << std::endl;
+        return false;
+    }
+
+    batch.pages.push_back(std::move(page));
+    return tryPage(batch.pages.back());
+}
+
+bool UploadContext::IsFailedValue(const uint64_t value) const
+{
+    return std::binary_search(_failedValues.begin(), _failedValues.end(), value);
+}
+
+uint64_t UploadContext::GetCompletedValue() const
+{
+    uint64_t value{0};
+    const VkResult result = vkGetSemaphoreCounterValue(_device, _timelineSemaphore, &value);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to get upload timeline value: " << result << std::endl;
+        return 0;
+    }
+    return value;
+}
+
+} // namespace velecs::graphics
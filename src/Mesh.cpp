@@ -10,6 +10,9 @@
 
 #include "velecs/graphics/Mesh.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace velecs::graphics {
 
 // Public Fields
@@ -171,6 +174,35 @@ size_t Mesh::GetPrimitiveCount() const
 
 // Private Methods
 
+BoundingVolume Mesh::ComputeBounds() const
+{
+    BoundingVolume bounds{};
+    if (vertices.empty()) return bounds;
+
+    float min[3]{vertices[0].pos.x, vertices[0].pos.y, vertices[0].pos.z};
+    float max[3]{min[0], min[1], min[2]};
+    for (const Vertex& vertex : vertices)
+    {
+        const float pos[3]{vertex.pos.x, vertex.pos.y, vertex.pos.z};
+        for (int axis{0}; axis < 3; ++axis)
+        {
+            min[axis] = std::min(min[axis], pos[axis]);
+            max[axis] = std::max(max[axis], pos[axis]);
+        }
+    }
+
+    float radiusSquared{0.0f};
+    for (int axis{0}; axis < 3; ++axis)
+    {
+        bounds.center[axis] = (min[axis] + max[axis]) * 0.5f;
+        bounds.extents[axis] = (max[axis] - min[axis]) * 0.5f;
+        radiusSquared += bounds.extents[axis] * bounds.extents[axis];
+    }
+    bounds.radius = std::sqrt(radiusSquared);
+
+    return bounds;
+}
+
 std::unique_ptr<Assimp::Importer> Mesh::AssimpLoadScene(const std::filesystem::path& filePath)
 {
     if (!filePath.has_extension())
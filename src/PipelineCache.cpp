@@ -0,0 +1,254 @@
+/// @file    PipelineCache.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 18:12:37
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/PipelineCache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <system_error>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+const std::chrono::seconds PipelineCache::AUTOSAVE_INTERVAL{30};
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool PipelineCache::Init(const VkDevice device, const VkPhysicalDevice physicalDevice, const std::filesystem::path& filePath)
+{
+    _device = device;
+    _filePath = filePath;
+    vkGetPhysicalDeviceProperties(physicalDevice, &_deviceProperties);
+
+    std::vector<uint8_t> data;
+    {
+        std::ifstream file{_filePath, std::ios::binary};
+        if (file) data.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+    }
+
+    if (!data.empty() && !IsCompatible(data))
+    {
+        std::cout << "Discarding pipeline cache written by another device or driver: " << _filePath.string() << std::endl;
+        data.clear();
+    }
+
+    VkPipelineCacheCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    info.pNext = nullptr;
+    info.initialDataSize = data.size();
+    info.pInitialData = data.empty() ? nullptr : data.data();
+
+    VkResult result = vkCreatePipelineCache(_device, &info, nullptr, &_cache);
+    if (result != VK_SUCCESS && !data.empty())
+    {
+        // The header matched but the driver still refused the contents, start over from an empty cache
+        std::cout << "Discarding unreadable pipeline cache: " << _filePath.string() << std::endl;
+        info.initialDataSize = 0;
+        info.pInitialData = nullptr;
+        result = vkCreatePipelineCache(_device, &info, nullptr, &_cache);
+    }
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create pipeline cache: " << result << std::endl;
+        return false;
+    }
+
+    _lastSaveTime = std::chrono::steady_clock::now();
+
+    return true;
+}
+
+void PipelineCache::Cleanup()
+{
+    if (_cache == VK_NULL_HANDLE) return;
+
+    Save();
+
+    vkDestroyPipelineCache(_device, _cache, nullptr);
+    _cache = VK_NULL_HANDLE;
+}
+
+bool PipelineCache::Save()
+{
+    if (_cache == VK_NULL_HANDLE) return false;
+
+    // Both would write the same temporary file
+    if (_pendingSave.valid()) _pendingSave.get();
+
+    const bool wasDirty = BeginSave();
+
+    std::vector<uint8_t> data;
+    if (!GetData(data) || !WriteFile(data))
+    {
+        EndSave(wasDirty);
+        return false;
+    }
+
+    return true;
+}
+
+void PipelineCache::Update(WorkerPool& workers)
+{
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (!_dirty || std::chrono::steady_clock::now() - _lastSaveTime < AUTOSAVE_INTERVAL) return;
+    }
+
+    // The previous save is still writing, the next frame tries again
+    if (_pendingSave.valid())
+    {
+        if (_pendingSave.wait_for(std::chrono::seconds{0}) != std::future_status::ready) return;
+        _pendingSave.get();
+    }
+
+    const bool wasDirty = BeginSave();
+
+    std::vector<uint8_t> data;
+    if (!GetData(data))
+    {
+        EndSave(wasDirty);
+        return;
+    }
+
+    // Large caches take a while to write, the render thread does not wait for the disk
+    _pendingSave = workers.Submit([this, wasDirty, data = std::move(data)]() {
+        if (!WriteFile(data)) EndSave(wasDirty);
+    });
+}
+
+void PipelineCache::RecordFeedback(const VkPipelineCreationFeedback& feedback)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Without valid feedback the pipeline may have been compiled, so the cache may have grown
+    if (!(feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT))
+    {
+        _dirty = true;
+        return;
+    }
+
+    ++_stats.pipelineCount;
+    _stats.milliseconds += static_cast<double>(feedback.duration) / 1000000.0;
+
+    if (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT)
+    {
+        ++_stats.cacheHitCount;
+    }
+    else
+    {
+        _dirty = true;
+    }
+}
+
+PipelineCacheStats PipelineCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _stats;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+bool PipelineCache::IsCompatible(const std::vector<uint8_t>& data) const
+{
+    VkPipelineCacheHeaderVersionOne header{};
+    if (data.size() < sizeof(header)) return false;
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    return header.headerSize >= sizeof(header)
+        && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+        && header.vendorID == _deviceProperties.vendorID
+        && header.deviceID == _deviceProperties.deviceID
+        && std::memcmp(header.pipelineCacheUUID, _deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+bool PipelineCache::BeginSave()
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Cleared before reading the contents, so pipelines compiled while saving mark the cache dirty again
+    const bool wasDirty = _dirty;
+    _dirty = false;
+    _lastSaveTime = std::chrono::steady_clock::now();
+    return wasDirty;
+}
+
+void PipelineCache::EndSave(const bool wasDirty)
+{
+    // The save failed, the contents it missed still have to be written
+    std::lock_guard<std::mutex> lock{_mutex};
+    _dirty = _dirty || wasDirty;
+}
+
+bool PipelineCache::GetData(std::vector<uint8_t>& data) const
+{
+    VkResult result{VK_INCOMPLETE};
+    size_t size{0};
+
+    // Background compiles may grow the cache between the size query and the copy
+    while (result == VK_INCOMPLETE)
+    {
+        result = vkGetPipelineCacheData(_device, _cache, &size, nullptr);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to get pipeline cache size: " << result << std::endl;
+            return false;
+        }
+
+        data.resize(size);
+        result = vkGetPipelineCacheData(_device, _cache, &size, data.data());
+        if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+        {
+            std::cerr << "Failed to get pipeline cache data: " << result << std::endl;
+            return false;
+        }
+    }
+
+    data.resize(size);
+    return true;
+}
+
+bool PipelineCache::WriteFile(const std::vector<uint8_t>& data) const
+{
+    std::error_code error;
+    std::filesystem::create_directories(_filePath.parent_path(), error);
+
+    std::filesystem::path tempPath = _filePath;
+    tempPath += ".tmp";
+    {
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+        if (!file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+        {
+            std::cerr << "Failed to write pipeline cache: " << tempPath.string() << std::endl;
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, _filePath, error);
+    if (error)
+    {
+        std::cerr << "Failed to replace pipeline cache: " << error.message() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace velecs::graphics
@@ -0,0 +1,217 @@
+/// @file    PipelineLayoutCache.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 21:22:09
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/PipelineLayoutCache.hpp"
+
+#include "velecs/graphics/Shader/SpirVHash.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void PipelineLayoutCache::Init(const VkDevice device)
+{
+    _device = device;
+}
+
+void PipelineLayoutCache::Cleanup()
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Pipeline layouts first, they reference the set layouts
+    for (auto& [key, layout] : _pipelineLayouts)
+    {
+        vkDestroyPipelineLayout(_device, layout, nullptr);
+    }
+    _pipelineLayouts.clear();
+
+    for (auto& [key, layout] : _setLayouts)
+    {
+        vkDestroyDescriptorSetLayout(_device, layout, nullptr);
+    }
+    _setLayouts.clear();
+}
+
+VkDescriptorSetLayout PipelineLayoutCache::GetDescriptorSetLayout(std::vector<VkDescriptorSetLayoutBinding> bindings)
+{
+    std::sort(bindings.begin(), bindings.end(), [](const VkDescriptorSetLayoutBinding& a, const VkDescriptorSetLayoutBinding& b) {
+        return a.binding < b.binding;
+    });
+
+    std::vector<uint64_t> key;
+    key.reserve(bindings.size() * 2);
+    for (const VkDescriptorSetLayoutBinding& binding : bindings)
+    {
+        if (binding.pImmutableSamplers != nullptr)
+        {
+            throw std::runtime_error("Immutable samplers are not supported by the pipeline layout cache");
+        }
+
+        key.push_back((static_cast<uint64_t>(binding.binding) << 32) | static_cast<uint32_t>(binding.descriptorType));
+        key.push_back((static_cast<uint64_t>(binding.descriptorCount) << 32) | binding.stageFlags);
+    }
+
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto it = _setLayouts.find(key);
+    if (it != _setLayouts.end()) return it->second;
+
+    VkDescriptorSetLayoutCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    info.pNext = nullptr;
+    info.pBindings = bindings.data();
+    info.bindingCount = static_cast<uint32_t>(bindings.size());
+    info.flags = 0;
+
+    VkDescriptorSetLayout layout{VK_NULL_HANDLE};
+    VkResult result = vkCreateDescriptorSetLayout(_device, &info, nullptr, &layout);
+    if (result != VK_SUCCESS)
+    {
+        std::ostringstream oss;
+        oss << "Failed to create descriptor set layout: " << result;
+        throw std::runtime_error(oss.str());
+    }
+
+    _setLayouts.emplace(std::move(key), layout);
+
+    return layout;
+}
+
+VkPipelineLayout PipelineLayoutCache::GetPipelineLayout(
+    const std::vector<VkDescriptorSetLayout>& setLayouts,
+    const std::vector<VkPushConstantRange>& pushConstantRanges
+)
+{
+    std::vector<uint64_t> key;
+    key.reserve(1 + setLayouts.size() + pushConstantRanges.size() * 2);
+    key.push_back(setLayouts.size());
+    for (const VkDescriptorSetLayout setLayout : setLayouts)
+    {
+        key.push_back(reinterpret_cast<uint64_t>(setLayout));
+    }
+    for (const VkPushConstantRange& range : pushConstantRanges)
+    {
+        key.push_back(range.stageFlags);
+        key.push_back((static_cast<uint64_t>(range.offset) << 32) | range.size);
+    }
+
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto it = _pipelineLayouts.find(key);
+    if (it != _pipelineLayouts.end()) return it->second;
+
+    VkPipelineLayoutCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    info.pNext = nullptr;
+    info.flags = 0;
+    info.pSetLayouts = setLayouts.empty() ? nullptr : setLayouts.data();
+    info.setLayoutCount = static_cast<uint32_t>(setLayouts.size());
+    info.pPushConstantRanges = pushConstantRanges.empty() ? nullptr : pushConstantRanges.data();
+    info.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+
+    VkPipelineLayout layout{VK_NULL_HANDLE};
+    VkResult result = vkCreatePipelineLayout(_device, &info, nullptr, &layout);
+    if (result != VK_SUCCESS)
+    {
+        std::ostringstream oss;
+        oss << "Failed to create pipeline layout: " << result;
+        throw std::runtime_error(oss.str());
+    }
+
+    _pipelineLayouts.emplace(std::move(key), layout);
+
+    return layout;
+}
+
+std::vector<VkDescriptorSetLayout> PipelineLayoutCache::GetSetLayouts(
+    const ShaderReflectionData& data,
+    const std::vector<VkDescriptorSetLayout>& fixedSetLayouts
+)
+{
+    const std::vector<std::vector<VkDescriptorSetLayoutBinding>> setBindings = data.GetSetLayoutBindings();
+
+    std::vector<VkDescriptorSetLayout> setLayouts(std::max(fixedSetLayouts.size(), setBindings.size()), VK_NULL_HANDLE);
+    for (size_t set{0}; set < setLayouts.size(); ++set)
+    {
+        if (set < fixedSetLayouts.size() && fixedSetLayouts[set] != VK_NULL_HANDLE)
+        {
+            setLayouts[set] = fixedSetLayouts[set];
+            continue;
+        }
+
+        if (set >= setBindings.size())
+        {
+            // Only reached for a gap before a fixed set, given the empty layout
+            setLayouts[set] = GetDescriptorSetLayout({});
+            continue;
+        }
+
+        for (const VkDescriptorSetLayoutBinding& binding : setBindings[set])
+        {
+            // Their descriptor count is unknown, it needs variable count binding flags
+            if (binding.descriptorCount == 0)
+            {
+                std::ostringstream oss;
+                oss << "Runtime or specialization sized descriptor array at set " << set << ", binding " << binding.binding
+                    << " needs a fixed set layout";
+                throw std::runtime_error(oss.str());
+            }
+        }
+
+        // Unused sets below a used one get the empty layout
+        setLayouts[set] = GetDescriptorSetLayout(setBindings[set]);
+    }
+
+    return setLayouts;
+}
+
+VkPipelineLayout PipelineLayoutCache::GetPipelineLayout(
+    const ShaderReflectionData& data,
+    const std::vector<VkDescriptorSetLayout>& fixedSetLayouts,
+    const std::vector<VkPushConstantRange>& pushConstantRanges
+)
+{
+    return GetPipelineLayout(GetSetLayouts(data, fixedSetLayouts), pushConstantRanges);
+}
+
+size_t PipelineLayoutCache::GetDescriptorSetLayoutCount() const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _setLayouts.size();
+}
+
+size_t PipelineLayoutCache::GetPipelineLayoutCount() const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _pipelineLayouts.size();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+size_t PipelineLayoutCache::KeyHash::operator()(const std::vector<uint64_t>& key) const
+{
+    return static_cast<size_t>(Fnv1a(key.data(), key.size() * sizeof(uint64_t)));
+}
+
+} // namespace velecs::graphics
@@ -0,0 +1,101 @@
+/// @file    GpuPassStats.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 09:20:05
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Profiling/GpuPassStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+const size_t GpuPassStats::DEFAULT_WINDOW_SIZE = 120;
+
+// Constructors and Destructors
+
+GpuPassStats::GpuPassStats(const size_t windowSize /* = DEFAULT_WINDOW_SIZE*/)
+    : _windowSize(std::max<size_t>(windowSize, 1))
+{
+    _samples.reserve(_windowSize);
+}
+
+// Public Methods
+
+void GpuPassStats::AddSample(const double milliseconds)
+{
+    if (_samples.size() < _windowSize)
+    {
+        _samples.push_back(milliseconds);
+    }
+    else
+    {
+        _sum -= _samples[_nextSample];
+        _samples[_nextSample] = milliseconds;
+        _nextSample = (_nextSample + 1) % _windowSize;
+    }
+
+    _sum += milliseconds;
+    _latest = milliseconds;
+    ++_totalSampleCount;
+}
+
+void GpuPassStats::Reset()
+{
+    _samples.clear();
+    _nextSample = 0;
+    _totalSampleCount = 0;
+    _latest = 0.0;
+    _sum = 0.0;
+}
+
+double GpuPassStats::GetAverage() const
+{
+    if (_samples.empty()) return 0.0;
+    return _sum / static_cast<double>(_samples.size());
+}
+
+double GpuPassStats::GetMin() const
+{
+    if (_samples.empty()) return 0.0;
+    return *std::min_element(_samples.begin(), _samples.end());
+}
+
+double GpuPassStats::GetMax() const
+{
+    if (_samples.empty()) return 0.0;
+    return *std::max_element(_samples.begin(), _samples.end());
+}
+
+double GpuPassStats::GetPercentile(const double percentile) const
+{
+    if (_samples.empty()) return 0.0;
+
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const size_t count = _samples.size();
+
+    // Nearest-rank method
+    size_t rank = static_cast<size_t>(std::ceil(clamped / 100.0 * static_cast<double>(count)));
+    rank = std::clamp<size_t>(rank, 1, count);
+
+    std::vector<double> sorted = _samples;
+    std::nth_element(sorted.begin(), sorted.begin() + (rank - 1), sorted.end());
+    return sorted[rank - 1];
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
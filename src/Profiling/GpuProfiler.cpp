@@ -0,0 +1,192 @@
+/// @file    GpuProfiler.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 09:51:16
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Profiling/GpuProfiler.hpp"
+
+#include <iostream>
+#include <limits>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+const uint32_t GpuProfiler::DEFAULT_MAX_SCOPES_PER_FRAME = 32;
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool GpuProfiler::Init(
+    const VkDevice device,
+    const VkPhysicalDevice physicalDevice,
+    const uint32_t queueFamily,
+    const uint32_t frameCount,
+    const uint32_t maxScopesPerFrame /* = DEFAULT_MAX_SCOPES_PER_FRAME*/
+)
+{
+    _device = device;
+    _maxQueriesPerFrame = maxScopesPerFrame * 2;
+
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    _timestampPeriod = properties.limits.timestampPeriod;
+
+    uint32_t queueFamilyCount{0};
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+    const uint32_t validBits = (queueFamily < queueFamilyCount) ? queueFamilies[queueFamily].timestampValidBits : 0;
+    _validBitsMask = (validBits >= 64)
+        ? std::numeric_limits<uint64_t>::max()
+        : ((uint64_t{1} << validBits) - 1);
+
+    if (!IsSupported())
+    {
+        std::cerr << "Timestamp queries are not supported on the graphics queue, GPU profiling disabled." << std::endl;
+        return true;
+    }
+
+    VkQueryPoolCreateInfo queryPoolInfo{};
+    queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolInfo.pNext = nullptr;
+    queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolInfo.queryCount = _maxQueriesPerFrame;
+
+    _frames.resize(frameCount);
+    for (FrameQueries& frame : _frames)
+    {
+        const VkResult result = vkCreateQueryPool(_device, &queryPoolInfo, nullptr, &frame.queryPool);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to create timestamp query pool: " << result << std::endl;
+            // Pools not created yet are null, which vkDestroyQueryPool ignores
+            Cleanup();
+            return false;
+        }
+    }
+
+    _results.resize(_maxQueriesPerFrame);
+
+    return true;
+}
+
+void GpuProfiler::Cleanup()
+{
+    for (FrameQueries& frame : _frames)
+    {
+        vkDestroyQueryPool(_device, frame.queryPool, nullptr);
+    }
+    _frames.clear();
+    _recording = false;
+}
+
+void GpuProfiler::BeginFrame(const VkCommandBuffer cmd, const uint32_t frameIndex)
+{
+    _recording = false;
+    if (!IsSupported() || frameIndex >= _frames.size()) return;
+
+    _currentFrame = frameIndex;
+    FrameQueries& frame = _frames[_currentFrame];
+
+    CollectResults(frame);
+
+    frame.scopes.clear();
+    frame.queryCount = 0;
+    vkCmdResetQueryPool(cmd, frame.queryPool, 0, _maxQueriesPerFrame);
+
+    _recording = true;
+}
+
+uint32_t GpuProfiler::BeginScope(const VkCommandBuffer cmd, const std::string& name)
+{
+    if (!_recording) return INVALID_SCOPE;
+
+    FrameQueries& frame = _frames[_currentFrame];
+    if (frame.queryCount + 2 > _maxQueriesPerFrame) return INVALID_SCOPE;
+
+    Scope scope{};
+    scope.name = name;
+    scope.beginQuery = frame.queryCount++;
+    scope.endQuery = frame.queryCount++;
+
+    vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, frame.queryPool, scope.beginQuery);
+
+    frame.scopes.push_back(std::move(scope));
+    return static_cast<uint32_t>(frame.scopes.size() - 1);
+}
+
+void GpuProfiler::EndScope(const VkCommandBuffer cmd, const uint32_t scope)
+{
+    if (!_recording || scope == INVALID_SCOPE) return;
+
+    FrameQueries& frame = _frames[_currentFrame];
+    if (scope >= frame.scopes.size()) return;
+
+    // Bottom of pipe waits for every previously recorded command to complete
+    vkCmdWriteTimestamp2(cmd, VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT, frame.queryPool, frame.scopes[scope].endQuery);
+    frame.scopes[scope].ended = true;
+}
+
+const GpuPassStats* GpuProfiler::GetPassStats(const std::string& name) const
+{
+    auto it = _stats.find(name);
+    return (it != _stats.end()) ? &it->second : nullptr;
+}
+
+void GpuProfiler::ResetStats()
+{
+    _stats.clear();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+const uint32_t GpuProfiler::INVALID_SCOPE = std::numeric_limits<uint32_t>::max();
+
+// Private Methods
+
+void GpuProfiler::CollectResults(FrameQueries& frame)
+{
+    if (frame.queryCount == 0) return;
+
+    // No WAIT flag, the frame slot was already waited on so the results should be available.
+    // If they are not, the frame is dropped from the statistics rather than stalling.
+    const VkResult result = vkGetQueryPoolResults(
+        _device,
+        frame.queryPool,
+        0,
+        frame.queryCount,
+        frame.queryCount * sizeof(uint64_t),
+        _results.data(),
+        sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT
+    );
+    if (result != VK_SUCCESS) return;
+
+    const double nanosecondsToMilliseconds = static_cast<double>(_timestampPeriod) / 1000000.0;
+
+    for (const Scope& scope : frame.scopes)
+    {
+        if (!scope.ended) continue;
+
+        const uint64_t begin = _results[scope.beginQuery] & _validBitsMask;
+        const uint64_t end = _results[scope.endQuery] & _validBitsMask;
+        // Masking keeps the subtraction correct if the counter wrapped around
+        const uint64_t ticks = (end - begin) & _validBitsMask;
+
+        _stats[scope.name].AddSample(static_cast<double>(ticks) * nanosecondsToMilliseconds);
+    }
+}
+
+} // namespace velecs::graphics
@@ -24,6 +24,8 @@
 #include "velecs/graphics/Components/PerspectiveCamera.hpp"
 #include "velecs/graphics/Components/OrthographicCamera.hpp"
 #include "velecs/graphics/ObjectUniforms.hpp"
+#include "velecs/graphics/ObjectPushConstant.hpp"
+#include "velecs/graphics/ObjectData.hpp"
 #include "velecs/graphics/ComputePushConstants.hpp"
 
 #include <velecs/common/Paths.hpp>
@@ -45,6 +47,9 @@ using namespace velecs::ecs;
 #include <fstream>
 #include <chrono>
 #include <stdexcept>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
 
 namespace velecs::graphics {
 
@@ -54,6 +59,15 @@ const int RenderEngine::VULKAN_MAJOR_VERSION = 1;
 const int RenderEngine::VULKAN_MINOR_VERSION = 3;
 const int RenderEngine::VULKAN_PATCH_VERSION = 0;
 
+const VkPipelineStageFlags2 RenderEngine::SWAPCHAIN_ACQUIRE_WAIT_STAGE = VK_PIPELINE_STAGE_2_BLIT_BIT;
+
+const size_t RenderEngine::MIN_DRAWS_PER_RECORDING_TASK = 256;
+
+const uint32_t RenderEngine::PIPELINE_COMPILE_THREAD_COUNT = 1;
+
+const char* const RenderEngine::PIPELINE_CACHE_FILE_NAME = "pipeline_cache.bin";
+const char* const RenderEngine::SHADER_REFLECTION_CACHE_FILE_NAME = "shader_reflection.bin";
+
 const bool RenderEngine::ENABLE_VALIDATION_LAYERS
 #ifdef _DEBUG
     = true;
@@ -65,14 +79,27 @@ const bool RenderEngine::ENABLE_VALIDATION_LAYERS
 
 // Public Methods
 
-SDL_AppResult RenderEngine::Init(SDL_Window* const window)
+SDL_AppResult RenderEngine::Init(SDL_Window* const window, const RenderEngineConfig& config /* = RenderEngineConfig{}*/)
 {
+    if (!config.IsValid())
+    {
+        std::cerr << "Invalid render engine config: frames in flight must be between "
+            << RenderEngineConfig::MIN_FRAMES_IN_FLIGHT << " and " << RenderEngineConfig::MAX_FRAMES_IN_FLIGHT << std::endl;
+        return SDL_APP_FAILURE;
+    }
+
     _window = window;
+    _config = config;
+    _frames.resize(_config.framesInFlight);
 
     if (!InitVulkan()        ) return SDL_APP_FAILURE;
     if (!InitSwapchain()     ) return SDL_APP_FAILURE;
+    if (!InitWorkers()       ) return SDL_APP_FAILURE;
     if (!InitCommands()      ) return SDL_APP_FAILURE;
     if (!InitSyncStructures()) return SDL_APP_FAILURE;
+    if (!InitUploadContext() ) return SDL_APP_FAILURE;
+    if (!InitPipelineCache() ) return SDL_APP_FAILURE;
+    if (!InitProfiler()      ) return SDL_APP_FAILURE;
     if (!InitDescriptors()   ) return SDL_APP_FAILURE;
     if (!InitPipelines()     ) return SDL_APP_FAILURE;
     if (!InitImgui()         ) return SDL_APP_FAILURE;
@@ -82,8 +109,109 @@ SDL_AppResult RenderEngine::Init(SDL_Window* const window)
     return SDL_APP_CONTINUE;
 }
 
+SDL_AppResult RenderEngine::InitHeadless(const VkExtent2D extent, const RenderEngineConfig& config /* = RenderEngineConfig{}*/)
+{
+    if (!config.IsValid())
+    {
+        std::cerr << "Invalid render engine config: frames in flight must be between "
+            << RenderEngineConfig::MIN_FRAMES_IN_FLIGHT << " and " << RenderEngineConfig::MAX_FRAMES_IN_FLIGHT << std::endl;
+        return SDL_APP_FAILURE;
+    }
+
+    _config = config;
+    _frames.resize(_config.framesInFlight);
+
+    _window = nullptr;
+    _headless = true;
+    _headlessExtent = extent;
+
+    if (!InitVulkan()         ) return SDL_APP_FAILURE;
+    if (!InitSwapchain()      ) return SDL_APP_FAILURE;
+    if (!InitWorkers()        ) return SDL_APP_FAILURE;
+    if (!InitCommands()       ) return SDL_APP_FAILURE;
+    if (!InitSyncStructures() ) return SDL_APP_FAILURE;
+    if (!InitUploadContext()  ) return SDL_APP_FAILURE;
+    if (!InitPipelineCache()  ) return SDL_APP_FAILURE;
+    if (!InitProfiler()       ) return SDL_APP_FAILURE;
+    if (!InitDescriptors()    ) return SDL_APP_FAILURE;
+    if (!InitPipelines()      ) return SDL_APP_FAILURE;
+    if (!InitReadbackBuffers()) return SDL_APP_FAILURE;
+
+    _initialized = true;
+
+    return SDL_APP_CONTINUE;
+}
+
+bool RenderEngine::ReadbackFrame(std::vector<uint8_t>& pixels)
+{
+    if (!_headless || _frameNumber == 0) return false;
+
+    // The previous frame slot is not reused until the next Draw(), so its buffer holds the last frame
+    FrameData& frame = _frames[GetFrameIndex(_frameNumber - 1)];
+
+    if (!WaitForFrame(frame.timelineValue, 1000000000)) return false;
+
+    frame.readbackBuffer->Invalidate();
+
+    const size_t size = static_cast<size_t>(frame.readbackBuffer->GetSize());
+    pixels.resize(size);
+    std::memcpy(pixels.data(), frame.readbackBuffer->GetMappedData(), size);
+
+    return true;
+}
+
+bool RenderEngine::UploadMesh(Mesh& mesh)
+{
+    // Retired once the GPU finished the frame being recorded, the mesh is not drawn until its new buffers are ready
+    return mesh.NewUpload(_device, _allocator, _uploadContext, _retiredDeletionQueue, GetRecordingFrameValue());
+}
+
+uint64_t RenderEngine::GetCompletedFrameValue() const
+{
+    uint64_t value{0};
+    const VkResult result = vkGetSemaphoreCounterValue(_device, _graphicsTimeline, &value);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to get frame timeline value: " << result << std::endl;
+        return 0;
+    }
+    return value;
+}
+
+bool RenderEngine::WaitForFrame(const uint64_t frameValue, const uint64_t timeout /* = UINT64_MAX*/) const
+{
+    if (frameValue == 0) return true;
+
+    VkSemaphoreWaitInfo waitInfo{};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.pNext = nullptr;
+    waitInfo.flags = 0;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &_graphicsTimeline;
+    waitInfo.pValues = &frameValue;
+
+    const VkResult result = vkWaitSemaphores(_device, &waitInfo, timeout);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to wait for frame: " << result << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void RenderEngine::ReleaseBindlessIndex(const BindlessHeap::ResourceType type, const uint32_t index)
+{
+    // Submitted frames may still read the index, it is reused once the frame being recorded completed
+    _retiredDeletionQueue.PushDeleter([this, type, index]() {
+        _bindlessHeap.Free(type, index);
+    }, GetRecordingFrameValue());
+}
+
 void RenderEngine::StartGUI()
 {
+    if (_headless) return;
+
     // Start the Dear ImGui frame
     ImGui_ImplVulkan_NewFrame();
     ImGui_ImplSDL3_NewFrame();
@@ -105,47 +233,73 @@ void RenderEngine::StartGUI()
         ImGui::InputFloat4("data4", (float*)&pushConstant.data4);
     }
     ImGui::End();
+
+    if (ImGui::Begin("pipelines"))
+    {
+        const PipelineCacheStats stats = _pipelineCache.GetStats();
+
+        ImGui::Text("Created: %u", stats.pipelineCount);
+        ImGui::Text("Cache hits: %u / %u", stats.cacheHitCount, stats.pipelineCount);
+        ImGui::Text("Creation time: %.3f ms", stats.milliseconds);
+        ImGui::Text("Set layouts: %zu", _pipelineLayoutCache.GetDescriptorSetLayoutCount());
+        ImGui::Text("Pipeline layouts: %zu", _pipelineLayoutCache.GetPipelineLayoutCount());
+        ImGui::Text("Graphics pipelines: %zu", _pipelineStateCache.GetPipelineCount());
+        ImGui::Text("Graphics pipelines reused: %llu", static_cast<unsigned long long>(_pipelineStateCache.GetReuseCount()));
+    }
+    ImGui::End();
+
+    if (_config.cpuCulling)
+    {
+        if (ImGui::Begin("culling"))
+        {
+            const CullStats& stats = _cpuCuller.GetStats();
+
+            ImGui::Text("Kernel: %s", FrustumCuller::GetKernelName());
+            ImGui::Text("Visible: %zu / %zu", stats.visibleCount, stats.objectCount);
+            ImGui::Text("Time: %.3f ms on %u threads", stats.milliseconds, stats.taskCount);
+            ImGui::Text("Objects per ms per core: %.0f", stats.GetObjectsPerMillisecondPerCore());
+        }
+        ImGui::End();
+    }
 }
 
 void RenderEngine::EndGUI()
 {
+    if (_headless) return;
+
     // Make imgui calculate internal draw structures
     ImGui::Render();
 }
 
 void RenderEngine::Draw(Scene* const scene)
 {
-    // Wait until the GPU has finished rendering the last frame. Timeout of 1 second
-    VkResult result = vkWaitForFences(_device, 1, &(GetCurrentFrame().renderFence), true, 1000000000);
-    if (result != VK_SUCCESS)
-    {
-        std::cerr << "Failed to wait for fences: " << result << std::endl;
-        return;
-    }
+    // Wait until the GPU has finished the last frame that used this slot. Timeout of 1 second
+    if (!WaitForFrame(GetCurrentFrame().timelineValue, 1000000000)) return;
 
-    GetCurrentFrame().deletionQueue.Flush();
+    _retiredDeletionQueue.Retire(GetCompletedFrameValue());
 
-    result = vkResetFences(_device, 1, &(GetCurrentFrame().renderFence));
-    if (result != VK_SUCCESS)
-    {
-        std::cerr << "Failed to reset fences: " << result << std::endl;
-        return;
-    }
+    // The GPU finished reading the uniform blocks of this frame slot
+    _uniformRing.BeginFrame(static_cast<uint32_t>(GetFrameIndex(_frameNumber)));
 
-    // Request image from the swapchain
-    uint32_t swapchainImageIndex;
-    result = vkAcquireNextImageKHR(
-        _device,
-        _swapchain,
-        1000000000,
-        GetCurrentFrame().swapchainSemaphore,
-        nullptr,
-        &swapchainImageIndex
-    );
-    if (result != VK_SUCCESS)
+    // Pipelines compiled since the last save survive a crash
+    _pipelineCache.Update(_workerPool);
+
+    VkResult result{VK_SUCCESS};
+
+    if (!_headless)
     {
-        std::cerr << "Failed to acquire next image from swapchain: " << result << std::endl;
-        return;
+        const VkExtent2D windowExtent = GetWindowExtent();
+
+        // Nothing to render into while the window is minimized
+        if (windowExtent.width == 0 || windowExtent.height == 0) return;
+
+        // Not every platform reports a resize through VK_ERROR_OUT_OF_DATE_KHR
+        if (windowExtent.width != _swapchainExtent.width || windowExtent.height != _swapchainExtent.height)
+        {
+            _swapchainDirty = true;
+        }
+
+        if (_swapchainDirty && !RecreateSwapchain()) return;
     }
 
     // Short alias for current frame's main command buffer
@@ -153,6 +307,7 @@ void RenderEngine::Draw(Scene* const scene)
 
     // Now that we are sure that the commands finished executing,
     // we can safely reset the command buffer to begin recording again.
+    // Done before acquiring, a failure here must not leave the acquire semaphore signaled
     result = vkResetCommandBuffer(cmd, 0);
     if (result != VK_SUCCESS)
     {
@@ -164,9 +319,6 @@ void RenderEngine::Draw(Scene* const scene)
     // We will use this command buffer exactly once, so we want to let Vulkan know that
     VkCommandBufferBeginInfo cmdBeginInfo = VkExtCommandBufferBeginInfo(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
 
-    _drawExtent.width = _drawImage.imageExtent.width;
-    _drawExtent.height = _drawImage.imageExtent.height;
-
     // Start the command buffer recording
     result = vkBeginCommandBuffer(cmd, &cmdBeginInfo);
     if (result != VK_SUCCESS)
@@ -175,41 +327,91 @@ void RenderEngine::Draw(Scene* const scene)
         return;
     }
 
-    // Change swapchain image's to writeable mode before rendering
-    TransitionImage(cmd, _drawImage.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
+    // The compute command buffer is submitted every frame so the graphics semaphore of the previous one is always consumed
+    const VkCommandBuffer computeCmd = HasAsyncCompute() ? GetCurrentFrame().computeCommandBuffer : VK_NULL_HANDLE;
+    if (computeCmd != VK_NULL_HANDLE)
+    {
+        result = vkResetCommandBuffer(computeCmd, 0);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to reset compute command buffer: " << result << std::endl;
+            return;
+        }
 
-    DrawBackground(cmd);
+        result = vkBeginCommandBuffer(computeCmd, &cmdBeginInfo);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to begin compute command buffer recording: " << result << std::endl;
+            return;
+        }
+    }
 
-    TransitionImage(cmd, _drawImage.image, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    // Request image from the swapchain
+    uint32_t swapchainImageIndex{0};
+    if (!_headless)
+    {
+        result = vkAcquireNextImageKHR(
+            _device,
+            _swapchain,
+            1000000000,
+            GetCurrentFrame().swapchainSemaphore,
+            nullptr,
+            &swapchainImageIndex
+        );
+        if (result == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            // The semaphore was not signaled, so the frame can simply be retried after recreation
+            _swapchainDirty = true;
+            return;
+        }
+        else if (result == VK_SUBOPTIMAL_KHR)
+        {
+            // The image was acquired and the semaphore will be signaled, so this frame must still be presented
+            _swapchainDirty = true;
+        }
+        else if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to acquire next image from swapchain: " << result << std::endl;
+            return;
+        }
+    }
 
-    DrawGeometry(cmd, scene);
+    // The draw image covers the whole display, only the part matching the swapchain is rendered
+    _drawExtent.width = std::min(_drawImage.imageExtent.width, _swapchainExtent.width);
+    _drawExtent.height = std::min(_drawImage.imageExtent.height, _swapchainExtent.height);
 
-    // Transition the draw image and the swapchain image to their correct transfer layouts
-    TransitionImage(cmd, _drawImage.image, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
-    TransitionImage(cmd, _swapchainImages[swapchainImageIndex], VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    if (!BuildRenderGraph(scene, swapchainImageIndex))
+    {
+        DiscardAcquiredImage();
+        return;
+    }
 
-    // Execute a copy from the draw image into the swapchain
-    CopyImageToImage(cmd, _drawImage.image, _swapchainImages[swapchainImageIndex], _drawExtent, _swapchainExtent);
+    // Send the uploads queued since the last frame and take over the resources of the completed ones
+    _uploadContext.Submit();
+    const uint64_t uploadWaitValue = _uploadContext.RecordAcquires(cmd);
 
-    // Set swapchain image layout to Attachment Optimal so we can draw it
-    TransitionImage(
-        cmd,
-        _swapchainImages[swapchainImageIndex],
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
-    );
+    // Collect the timestamps of the last use of this frame slot, its timeline value was waited on above
+    _gpuProfiler.BeginFrame(cmd, static_cast<uint32_t>(GetFrameIndex(_frameNumber)));
+    const uint32_t frameScope = _gpuProfiler.BeginScope(cmd, "Frame");
 
-    // Draw imgui into the swapchain image
-    DrawImgui(cmd,  _swapchainImageViews[swapchainImageIndex]);
+    // Barriers between passes are derived from their declared image accesses
+    _renderGraph.Execute(cmd, &_gpuProfiler, computeCmd);
+    _uniformRing.Flush();
 
-    // Set swapchain image layout to Present so we can draw it
-    TransitionImage(cmd, _swapchainImages[swapchainImageIndex], VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+    _gpuProfiler.EndScope(cmd, frameScope);
 
     // Finalize the command buffer (we can no longer add commands, but it can now be executed)
     result = vkEndCommandBuffer(cmd);
     if (result != VK_SUCCESS)
     {
         std::cerr << "Failed to end command buffer recording: " << result << std::endl;
+        DiscardAcquiredImage();
+        return;
+    }
+
+    if (computeCmd != VK_NULL_HANDLE && !SubmitAsyncCompute(computeCmd))
+    {
+        DiscardAcquiredImage();
         return;
     }
 
@@ -218,28 +420,73 @@ void RenderEngine::Draw(Scene* const scene)
     // We will signal the renderSemaphore, to signal that rendering has finished
 
     VkCommandBufferSubmitInfo cmdinfo = VkExtCommandBufferSubmitInfo(cmd);
-    
-    VkSemaphoreSubmitInfo waitInfo = VkExtSemaphoreSubmitInfo(
-        VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR,
-        GetCurrentFrame().swapchainSemaphore
+
+    VkSubmitInfo2 submit = VkExtSubmitInfo2(&cmdinfo, nullptr, nullptr);
+
+    VkSemaphoreSubmitInfo waitInfos[3]{};
+    VkSemaphoreSubmitInfo signalInfos[2]{};
+    uint32_t waitCount{0};
+    uint32_t signalCount{0};
+    if (!_headless)
+    {
+        waitInfos[waitCount++] = VkExtSemaphoreSubmitInfo(
+            SWAPCHAIN_ACQUIRE_WAIT_STAGE,
+            GetCurrentFrame().swapchainSemaphore
+        );
+
+        signalInfos[signalCount++] = VkExtSemaphoreSubmitInfo(
+            VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT,
+            _renderSemaphores[swapchainImageIndex]
+        );
+    }
+
+    if (computeCmd != VK_NULL_HANDLE)
+    {
+        // Only the passes consuming compute results wait, earlier graphics work can overlap with the compute queue
+        VkPipelineStageFlags2 computeWaitStages = _renderGraph.GetComputeWaitStages();
+        if (computeWaitStages == VK_PIPELINE_STAGE_2_NONE) computeWaitStages = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+        waitInfos[waitCount++] = VkExtSemaphoreSubmitInfo(computeWaitStages, _computeTimeline, _computeTimelineValue);
+    }
+
+    if (uploadWaitValue > 0)
+    {
+        // Orders the acquires after the releases, the value was already reached so this never stalls
+        waitInfos[waitCount++] = VkExtSemaphoreSubmitInfo(
+            VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+            _uploadContext.GetTimelineSemaphore(),
+            uploadWaitValue
+        );
+    }
+
+    // Tracks the frame's completion, and lets the next frame's compute work reuse the images this frame is done with
+    signalInfos[signalCount++] = VkExtSemaphoreSubmitInfo(
+        VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        _graphicsTimeline,
+        GetRecordingFrameValue()
     );
 
-    VkSemaphoreSubmitInfo signalInfo = VkExtSemaphoreSubmitInfo(
-        VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT,
-        _renderSemaphores[swapchainImageIndex]
-    );    
-    
-    VkSubmitInfo2 submit = VkExtSubmitInfo2(&cmdinfo, &signalInfo, &waitInfo);
+    submit.waitSemaphoreInfoCount = waitCount;
+    submit.pWaitSemaphoreInfos = waitCount > 0 ? waitInfos : nullptr;
+    submit.signalSemaphoreInfoCount = signalCount;
+    submit.pSignalSemaphoreInfos = signalInfos;
 
     // Submit command buffer to the queue and execute it.
-    // renderFence will now block until the graphic commands finish execution
-    result = vkQueueSubmit2(_graphicsQueue, 1, &submit, GetCurrentFrame().renderFence);
+    result = vkQueueSubmit2(_graphicsQueue, 1, &submit, VK_NULL_HANDLE);
     if (result != VK_SUCCESS)
     {
         std::cerr << "Failed to submit to queue: " << result << std::endl;
+        DiscardAcquiredImage();
         return;
     }
 
+    GetCurrentFrame().timelineValue = GetRecordingFrameValue();
+
+    // Increase the number of frames drawn, the frame was submitted even if presenting fails
+    _frameNumber++;
+
+    if (_headless) return;
+
     // Prepare present
     // This will put the image we just rendered to into the visible window.
     // We want to wait on the renderSemaphore for that, 
@@ -254,14 +501,15 @@ void RenderEngine::Draw(Scene* const scene)
     presentInfo.pImageIndices = &swapchainImageIndex;
 
     result = vkQueuePresentKHR(_graphicsQueue, &presentInfo);
-    if (result != VK_SUCCESS)
+    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+    {
+        // Recreated at the start of the next frame
+        _swapchainDirty = true;
+    }
+    else if (result != VK_SUCCESS)
     {
         std::cerr << "Failed to present queue: " << result << std::endl;
-        return;
     }
-
-    // Increase the number of frames drawn
-    _frameNumber++;
 }
 
 void RenderEngine::Cleanup()
@@ -271,21 +519,38 @@ void RenderEngine::Cleanup()
     // Make sure the GPU has stopped doing its things
     vkDeviceWaitIdle(_device);
 
+    // Programs still compiling reference the device and the registry
+    _pipelineCompileWorkers.Cleanup();
+
     _rasterPrograms2.Clear();
 
-    for (size_t i{0}; i < FRAME_OVERLAP; ++i)
+    for (FrameData& frame : _frames)
     {
-        FrameData& frame = _frames[i];
-
         vkDestroyCommandPool(_device, frame.commandPool, nullptr);
+        for (const VkCommandPool pool : frame.workerCommandPools)
+        {
+            vkDestroyCommandPool(_device, pool, nullptr);
+        }
+
+        if (frame.computeCommandPool != VK_NULL_HANDLE)
+        {
+            vkDestroyCommandPool(_device, frame.computeCommandPool, nullptr);
+        }
 
         // Also destroy sync objects
-        vkDestroyFence(_device, frame.renderFence, nullptr);
         vkDestroySemaphore(_device, frame.swapchainSemaphore, nullptr);
 
-        frame.deletionQueue.Flush();
+        // Must be released before the allocator is destroyed by the main deletion queue
+        frame.readbackBuffer.reset();
+        frame.indirectDraws.Cleanup();
+        frame.instances.Cleanup();
     }
 
+    vkDestroySemaphore(_device, _graphicsTimeline, nullptr);
+    if (_computeTimeline != VK_NULL_HANDLE) vkDestroySemaphore(_device, _computeTimeline, nullptr);
+
+    _retiredDeletionQueue.Flush();
+
     const size_t swapchainImagesCount = _swapchainImages.size();
     for (size_t i{0}; i < swapchainImagesCount; ++i)
     {
@@ -294,9 +559,13 @@ void RenderEngine::Cleanup()
 
     _mainDeletionQueue.Flush();
 
-    CleanupSwapchain();
+    if (!_headless)
+    {
+        CleanupSwapchain();
+
+        vkDestroySurfaceKHR(_instance, _surface, nullptr);
+    }
 
-    vkDestroySurfaceKHR(_instance, _surface, nullptr);
     vkDestroyDevice(_device, nullptr);
     
     vkb::destroy_debug_utils_messenger(_instance, _debugMessenger);
@@ -315,18 +584,20 @@ void RenderEngine::Cleanup()
 
 bool RenderEngine::InitVulkan()
 {
-    const char* windowTitle = SDL_GetWindowTitle(_window);
+    const char* appName = _headless ? "Velecs Headless" : SDL_GetWindowTitle(_window);
 
     vkb::InstanceBuilder builder;
 
     auto builderResult = builder
-        .set_app_name(windowTitle)
+        .set_app_name(appName)
         .set_app_version(VK_MAKE_VERSION(1, 0, 0))
         .set_engine_name("Velecs Engine")
         .set_engine_version(VK_MAKE_VERSION(1, 0, 0))
         .require_api_version(VULKAN_MAJOR_VERSION, VULKAN_MINOR_VERSION, VULKAN_PATCH_VERSION)
         .request_validation_layers(ENABLE_VALIDATION_LAYERS)
         .use_default_debug_messenger()
+        // Skips enabling the surface extensions, which are unavailable without a display
+        .set_headless(_headless)
         .build()
         ;
 
@@ -375,7 +646,7 @@ bool RenderEngine::InitVulkan()
     }
 
     // Get the surface of the window we opened with SDL
-    if (!SDL_Vulkan_CreateSurface(_window, _instance, NULL, &_surface))
+    if (!_headless && !SDL_Vulkan_CreateSurface(_window, _instance, NULL, &_surface))
     {
         std::cerr << "Failed to create Vulkan surface. SDL Error: " << SDL_GetError() << std::endl;
         return false;
@@ -392,18 +663,43 @@ bool RenderEngine::InitVulkan()
     features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
     features12.bufferDeviceAddress = true;
     features12.descriptorIndexing = true;
+    features12.timelineSemaphore = true;
+    features12.drawIndirectCount = _config.indirectDraw;
+
+    if (_config.bindless)
+    {
+        features12.runtimeDescriptorArray = true;
+        features12.descriptorBindingPartiallyBound = true;
+        features12.descriptorBindingUpdateUnusedWhilePending = true;
+        features12.descriptorBindingSampledImageUpdateAfterBind = true;
+        features12.descriptorBindingStorageImageUpdateAfterBind = true;
+        features12.descriptorBindingStorageBufferUpdateAfterBind = true;
+        features12.shaderSampledImageArrayNonUniformIndexing = true;
+        features12.shaderStorageImageArrayNonUniformIndexing = true;
+        features12.shaderStorageBufferArrayNonUniformIndexing = true;
+    }
 
     // Use vkbootstrap to select a GPU.
     // We want a GPU that can write to the SDL surface and supports our version of Vulkan
     vkb::PhysicalDeviceSelector selector{ vkbInstance };
-    auto selectorResult = selector
+    selector
         .set_minimum_version(VULKAN_MAJOR_VERSION, VULKAN_MINOR_VERSION)
-        .set_surface(_surface)
         .set_required_features_13(features13)
         .set_required_features_12(features12)
-        .select()
         ;
 
+    if (_headless)
+    {
+        // Any GPU will do offscreen, including software implementations such as lavapipe
+        selector.require_present(false);
+    }
+    else
+    {
+        selector.set_surface(_surface);
+    }
+
+    auto selectorResult = selector.select();
+
     // Check if physical device selection was successful before proceeding
     if (!selectorResult)
     {
@@ -432,6 +728,49 @@ bool RenderEngine::InitVulkan()
     _graphicsQueue = vkbDevice.get_queue(vkb::QueueType::graphics).value();
     _graphicsQueueFamily = vkbDevice.get_queue_index(vkb::QueueType::graphics).value();
 
+    // Prefer a compute only family, then any family without graphics, so compute work can overlap with rendering.
+    // The device builder creates one queue per family, so every family can be used as is
+    _computeQueue = _graphicsQueue;
+    _computeQueueFamily = _graphicsQueueFamily;
+    if (_config.asyncCompute)
+    {
+        auto computeQueueIndex = vkbDevice.get_dedicated_queue_index(vkb::QueueType::compute);
+        if (!computeQueueIndex) computeQueueIndex = vkbDevice.get_separate_queue_index(vkb::QueueType::compute);
+
+        if (computeQueueIndex)
+        {
+            _computeQueueFamily = computeQueueIndex.value();
+            vkGetDeviceQueue(_device, _computeQueueFamily, 0, &_computeQueue);
+        }
+        else
+        {
+            std::cout << "No separate compute queue family, async compute runs on the graphics queue." << std::endl;
+        }
+    }
+
+    // Prefer a transfer only family, its copy engines run alongside rendering without sharing its queue.
+    // A family without graphics is only used if it is not already the async compute one
+    _transferQueue = _graphicsQueue;
+    _transferQueueFamily = _graphicsQueueFamily;
+    {
+        auto transferQueueIndex = vkbDevice.get_dedicated_queue_index(vkb::QueueType::transfer);
+        if (!transferQueueIndex)
+        {
+            transferQueueIndex = vkbDevice.get_separate_queue_index(vkb::QueueType::transfer);
+            if (transferQueueIndex && transferQueueIndex.value() == _computeQueueFamily) transferQueueIndex = {};
+        }
+
+        if (transferQueueIndex)
+        {
+            _transferQueueFamily = transferQueueIndex.value();
+            vkGetDeviceQueue(_device, _transferQueueFamily, 0, &_transferQueue);
+        }
+        else
+        {
+            std::cout << "No separate transfer queue family, uploads run on the graphics queue." << std::endl;
+        }
+    }
+
     // Initialize the VMA memory allocator
     VmaAllocatorCreateInfo allocatorInfo{};
     allocatorInfo.physicalDevice = _chosenGPU;
@@ -456,18 +795,26 @@ bool RenderEngine::InitVulkan()
 bool RenderEngine::InitSwapchain()
 {
     VkExtent2D windowExtent = GetWindowExtent();
-    CreateSwapchain(windowExtent);
 
-    // Reserve one render semaphore per swapchain image
-    // The swapchain does not always equal the number of frames
-    // Some GPUs have 2 swapchain images others have 3,
-    // My NVIDIA RTX 4070 SUPER has 3 instead of 2.
-    const size_t swapchainImagesCount = _swapchainImages.size();
-    _renderSemaphores.assign(swapchainImagesCount, VK_NULL_HANDLE);
+    if (_headless)
+    {
+        // Nothing to present to, the draw image is the final render target
+        _swapchainExtent = windowExtent;
+        return InitDrawImage(windowExtent);
+    }
+
+    if (!CreateSwapchain(windowExtent)) return false;
 
-    // TODO: Should GetWindowExtent() or _swapchainExtent be used?
-    windowExtent = _swapchainExtent;
+    // Size the draw image to cover the whole display so resizing the window never requires a new draw image
+    const VkExtent2D displayExtent = GetDisplayExtent();
+    windowExtent.width = std::max(_swapchainExtent.width, displayExtent.width);
+    windowExtent.height = std::max(_swapchainExtent.height, displayExtent.height);
 
+    return InitDrawImage(windowExtent);
+}
+
+bool RenderEngine::InitDrawImage(const VkExtent2D windowExtent)
+{
     // Draw image size will match the window
     const VkExtent3D drawImageExtent{
         windowExtent.width,
@@ -530,6 +877,30 @@ bool RenderEngine::InitSwapchain()
     return true;
 }
 
+bool RenderEngine::InitWorkers()
+{
+    if (!_workerPool.Init(_config.workerThreadCount))
+    {
+        std::cerr << "Failed to start the worker pool." << std::endl;
+        return false;
+    }
+
+    // A recording task queued behind a compile would stall the frame, so compiles get their own threads
+    if (!_pipelineCompileWorkers.Init(PIPELINE_COMPILE_THREAD_COUNT))
+    {
+        std::cerr << "Failed to start the pipeline compile workers." << std::endl;
+        _workerPool.Cleanup();
+        return false;
+    }
+
+    _mainDeletionQueue.PushDeleter([this]() {
+        _pipelineCompileWorkers.Cleanup();
+        _workerPool.Cleanup();
+    });
+
+    return true;
+}
+
 bool RenderEngine::InitCommands()
 {
     // Create a command pool for commands submitted to the graphics queue.
@@ -539,7 +910,7 @@ bool RenderEngine::InitCommands()
         VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
     );
 
-    for (size_t i{0}; i < FRAME_OVERLAP; ++i)
+    for (size_t i{0}; i < _frames.size(); ++i)
     {
         VkResult result = vkCreateCommandPool(_device, &commandPoolCreateInfo, nullptr, &_frames[i].commandPool);
         if (result != VK_SUCCESS)
@@ -563,39 +934,135 @@ bool RenderEngine::InitCommands()
         }
     }
 
+    if (HasAsyncCompute())
+    {
+        VkCommandPoolCreateInfo computePoolCreateInfo = VkExtCommandPoolCreateInfo(
+            _computeQueueFamily,
+            VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
+        );
+
+        for (size_t i{0}; i < _frames.size(); ++i)
+        {
+            VkResult result = vkCreateCommandPool(_device, &computePoolCreateInfo, nullptr, &_frames[i].computeCommandPool);
+            if (result != VK_SUCCESS)
+            {
+                std::cerr << "Failed to create compute command pool: " << result << std::endl;
+                return false;
+            }
+
+            VkCommandBufferAllocateInfo cmdAllocInfo = VkExtCommandBufferAllocateInfo(
+                _frames[i].computeCommandPool,
+                1,
+                VK_COMMAND_BUFFER_LEVEL_PRIMARY
+            );
+
+            result = vkAllocateCommandBuffers(_device, &cmdAllocInfo, &_frames[i].computeCommandBuffer);
+            if (result != VK_SUCCESS)
+            {
+                std::cerr << "Failed to allocate compute command buffers: " << result << std::endl;
+                return false;
+            }
+        }
+    }
+
+    // Recording threads each need their own pool, command pools must be externally synchronized.
+    // The render thread records alongside the workers, so it gets a pool too.
+    // Worker pools are reset as a whole every frame, which is cheaper than resetting individual buffers
+    const uint32_t recordingThreadCount = _workerPool.GetThreadCount() + 1;
+    VkCommandPoolCreateInfo workerPoolCreateInfo = VkExtCommandPoolCreateInfo(
+        _graphicsQueueFamily,
+        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT
+    );
+
+    for (size_t i{0}; i < _frames.size(); ++i)
+    {
+        _frames[i].workerCommandPools.resize(recordingThreadCount, VK_NULL_HANDLE);
+        _frames[i].workerCommandBuffers.resize(recordingThreadCount, VK_NULL_HANDLE);
+
+        for (uint32_t j{0}; j < recordingThreadCount; ++j)
+        {
+            VkResult result = vkCreateCommandPool(_device, &workerPoolCreateInfo, nullptr, &_frames[i].workerCommandPools[j]);
+            if (result != VK_SUCCESS)
+            {
+                std::cerr << "Failed to create worker command pool: " << result << std::endl;
+                return false;
+            }
+
+            VkCommandBufferAllocateInfo cmdAllocInfo = VkExtCommandBufferAllocateInfo(
+                _frames[i].workerCommandPools[j],
+                1,
+                VK_COMMAND_BUFFER_LEVEL_SECONDARY
+            );
+
+            result = vkAllocateCommandBuffers(_device, &cmdAllocInfo, &_frames[i].workerCommandBuffers[j]);
+            if (result != VK_SUCCESS)
+            {
+                std::cerr << "Failed to allocate secondary command buffers: " << result << std::endl;
+                return false;
+            }
+        }
+    }
+
     return true;
 }
 
-bool RenderEngine::InitSyncStructures()
+bool RenderEngine::InitReadbackBuffers()
 {
-    // Create syncronization structures
-    // One fence to control when the gpu has finished rendering the frame,
-    // and 2 semaphores to synchronize rendering with swapchain
-    // We want the fence to start signalled so we can wait on it on the first frame
-    VkFenceCreateInfo fenceCreateInfo = VkExtFenceCreateInfo(VK_FENCE_CREATE_SIGNALED_BIT);
-    VkSemaphoreCreateInfo semaphoreCreateInfo = VkExtSemaphoreCreateInfo();
+    const VkDeviceSize readbackSize = static_cast<VkDeviceSize>(_drawImage.imageExtent.width)
+        * _drawImage.imageExtent.height
+        * GetTexelSize(_drawImage.imageFormat);
 
-    for (size_t i{0}; i < FRAME_OVERLAP; ++i)
+    for (size_t i{0}; i < _frames.size(); ++i)
     {
-        VkResult result = vkCreateFence(_device, &fenceCreateInfo, nullptr, &(_frames[i].renderFence));
-        if (result != VK_SUCCESS)
+        // One buffer per frame so a frame can be read while the next one is being copied
+        _frames[i].readbackBuffer = AllocatedBuffer::TryCreateBuffer(
+            _allocator,
+            static_cast<size_t>(readbackSize),
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VMA_MEMORY_USAGE_GPU_TO_CPU
+        );
+        if (!_frames[i].readbackBuffer)
         {
-            std::cerr << "Failed to create fence: " << result << std::endl;
+            std::cerr << "Failed to create readback buffer." << std::endl;
             return false;
         }
+    }
 
-        result = vkCreateSemaphore(_device, &semaphoreCreateInfo, nullptr, &(_frames[i].swapchainSemaphore));
+    return true;
+}
+
+bool RenderEngine::InitSyncStructures()
+{
+    // Create syncronization structures
+    // One timeline semaphore per queue tracks GPU progress, the graphics one is signaled with the frame value,
+    // and one binary semaphore per frame waits for the swapchain image since acquiring cannot signal a timeline
+    VkSemaphoreTypeCreateInfo timelineTypeInfo = VkExtSemaphoreTypeCreateInfo(VK_SEMAPHORE_TYPE_TIMELINE);
+    VkSemaphoreCreateInfo timelineCreateInfo = VkExtSemaphoreCreateInfo();
+    timelineCreateInfo.pNext = &timelineTypeInfo;
+
+    VkResult result = vkCreateSemaphore(_device, &timelineCreateInfo, nullptr, &_graphicsTimeline);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create timeline semaphore: " << result << std::endl;
+        return false;
+    }
+
+    if (HasAsyncCompute())
+    {
+        // Orders the compute and graphics submissions, which do not share a queue
+        result = vkCreateSemaphore(_device, &timelineCreateInfo, nullptr, &_computeTimeline);
         if (result != VK_SUCCESS)
         {
-            std::cerr << "Failed to create semaphore: " << result << std::endl;
+            std::cerr << "Failed to create timeline semaphore: " << result << std::endl;
             return false;
         }
     }
 
-    const size_t swapchainImagesCount = _swapchainImages.size();
-    for (size_t i{0}; i < swapchainImagesCount; ++i)
+    VkSemaphoreCreateInfo semaphoreCreateInfo = VkExtSemaphoreCreateInfo();
+
+    for (size_t i{0}; i < _frames.size(); ++i)
     {
-        VkResult result = vkCreateSemaphore(_device, &semaphoreCreateInfo, nullptr, &_renderSemaphores[i]);
+        result = vkCreateSemaphore(_device, &semaphoreCreateInfo, nullptr, &(_frames[i].swapchainSemaphore));
         if (result != VK_SUCCESS)
         {
             std::cerr << "Failed to create semaphore: " << result << std::endl;
@@ -603,25 +1070,137 @@ bool RenderEngine::InitSyncStructures()
         }
     }
 
-    return true;
+    return InitRenderSemaphores();
 }
 
-bool RenderEngine::InitDescriptors()
+bool RenderEngine::InitUploadContext()
+{
+    if (!_uploadContext.Init(_device, _allocator, _transferQueue, _transferQueueFamily, _graphicsQueueFamily))
+    {
+        return false;
+    }
+
+    _mainDeletionQueue.PushDeleter([&]() {
+        _uploadContext.Cleanup();
+    });
+
+    return true;
+}
+
+bool RenderEngine::InitPipelineCache()
+{
+    if (!_pipelineCache.Init(_device, _chosenGPU, Paths::PersistentDataDir() / PIPELINE_CACHE_FILE_NAME)) return false;
+
+    // Loaded before any shader is reflected, a missing file only means reflecting from scratch
+    const std::filesystem::path reflectionCachePath = Paths::PersistentDataDir() / SHADER_REFLECTION_CACHE_FILE_NAME;
+    LoadReflectionCache(reflectionCachePath);
+    _mainDeletionQueue.PushDeleter([reflectionCachePath](){
+        SaveReflectionCache(reflectionCachePath);
+    });
+
+    // Pushed before any program exists, so it is flushed after every program released its modules
+    _shaderModuleCache.Init(_device);
+    _mainDeletionQueue.PushDeleter([&](){
+        _shaderModuleCache.Cleanup();
+    });
+
+    // Pushed before the descriptors and programs using its layouts, so it is flushed after them
+    _pipelineLayoutCache.Init(_device);
+    _mainDeletionQueue.PushDeleter([&](){
+        _pipelineLayoutCache.Cleanup();
+    });
+
+    _pipelineStateCache.Init(_device);
+    _mainDeletionQueue.PushDeleter([&](){
+        _pipelineStateCache.Cleanup();
+    });
+
+    _mainDeletionQueue.PushDeleter([&](){
+        const PipelineCacheStats stats = _pipelineCache.GetStats();
+        std::cout << "Pipeline cache: " << stats.cacheHitCount << " of " << stats.pipelineCount
+            << " pipelines hit, " << stats.milliseconds << " ms creating pipelines" << std::endl;
+
+        _pipelineCache.Cleanup();
+    });
+
+    return true;
+}
+
+bool RenderEngine::InitRenderSemaphores()
+{
+    // Reserve one render semaphore per swapchain image
+    // The swapchain does not always equal the number of frames
+    // Some GPUs have 2 swapchain images others have 3,
+    // My NVIDIA RTX 4070 SUPER has 3 instead of 2.
+    const size_t swapchainImagesCount = _swapchainImages.size();
+    _renderSemaphores.assign(swapchainImagesCount, VK_NULL_HANDLE);
+
+    VkSemaphoreCreateInfo semaphoreCreateInfo = VkExtSemaphoreCreateInfo();
+
+    for (size_t i{0}; i < swapchainImagesCount; ++i)
+    {
+        VkResult result = vkCreateSemaphore(_device, &semaphoreCreateInfo, nullptr, &_renderSemaphores[i]);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "Failed to create semaphore: " << result << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool RenderEngine::InitProfiler()
+{
+    if (!_gpuProfiler.Init(_device, _chosenGPU, _graphicsQueueFamily, static_cast<uint32_t>(_frames.size())))
+    {
+        return false;
+    }
+
+    _mainDeletionQueue.PushDeleter([&]() {
+        _gpuProfiler.Cleanup();
+    });
+
+    // Transient images of the render graph are created on first use
+    _renderGraph.Init(
+        _device,
+        _allocator,
+        _graphicsQueueFamily,
+        _computeQueueFamily,
+        static_cast<uint32_t>(_frames.size())
+    );
+    _mainDeletionQueue.PushDeleter([&]() {
+        _renderGraph.Cleanup();
+    });
+
+    return true;
+}
+
+bool RenderEngine::InitDescriptors()
 {
     // Create a descriptor pool that will hold 10 sets with 1 image each
     _globalDescriptorAllocator.InitPool(
         _device,
         10,
         std::vector<DescriptorAllocator::PoolSizeRatio>{
-            { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1 }
+            { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1 },
+            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1 }
         }
     );
 
-    // Make the descriptor set layout for our compute draw
-    _drawImageDescriptorLayout = DescriptorLayoutBuilder{}
-        .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE)
-        .Build(_device, VK_SHADER_STAGE_COMPUTE_BIT)
-        ;
+    // Make the descriptor set layout for our compute draw, the same handle the background effects reflect
+    try
+    {
+        _drawImageDescriptorLayout = DescriptorLayoutBuilder{}
+            .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE)
+            .Build(_pipelineLayoutCache, VK_SHADER_STAGE_COMPUTE_BIT)
+            ;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to create draw image descriptor layout: " << e.what() << std::endl;
+        return false;
+    }
     
     // Allocate a descriptor set for our draw image
     _drawImageDescriptors = _globalDescriptorAllocator.Allocate(_device, _drawImageDescriptorLayout);
@@ -642,19 +1221,41 @@ bool RenderEngine::InitDescriptors()
 
     vkUpdateDescriptorSets(_device, 1, &drawImageWrite, 0, nullptr);
 
-    // Make sure both the descriptor allocator and the new layout get cleaned up properly
+    const bool uniformRingCreated = _uniformRing.Init(
+        _device,
+        _chosenGPU,
+        _allocator,
+        _globalDescriptorAllocator,
+        static_cast<uint32_t>(_frames.size()),
+        _config.uniformRingBytesPerFrame,
+        sizeof(ObjectUniforms)
+    );
+
+    if (_config.bindless && !_bindlessHeap.Init(_device, _chosenGPU)) return false;
+
+    // Make sure the descriptor allocator gets cleaned up properly, the layout belongs to the layout cache
     _mainDeletionQueue.PushDeleter([&]() {
+        _bindlessHeap.Cleanup();
+        _uniformRing.Cleanup();
         _globalDescriptorAllocator.DestroyPool(_device);
-
-        vkDestroyDescriptorSetLayout(_device, _drawImageDescriptorLayout, nullptr);
     });
 
-    return true;
+    return uniformRingCreated;
 }
 
 bool RenderEngine::InitPipelines()
 {
-    if (!InitBackgroundPipeline()) return false;
+    // Pipelines are compiled on the workers, joined before the first frame
+    ShaderProgramBatch batch{
+        _workerPool,
+        _device,
+        &_pipelineCache,
+        &_shaderModuleCache,
+        &_pipelineLayoutCache,
+        &_pipelineStateCache
+    };
+
+    if (!InitBackgroundPipeline(batch)) return false;
 
     // VkPipelineLayout layout = RenderPipelineLayoutBuilder{}
     //     .SetDevice(_device)
@@ -675,9 +1276,12 @@ bool RenderEngine::InitPipelines()
         .DisableDepthTest()
         .SetDepthFormat(VK_FORMAT_UNDEFINED)
         ;
-    program->Init(_device, _drawImage.imageFormat);
-
     _rasterPrograms.push_back(std::move(program));
+    batch.Add(*_rasterPrograms.back(), _drawImage.imageFormat);
+
+    // Created on the render thread while the workers compile the batch
+    const bool cullingPipelineCreated = InitCullingPipeline();
+    if (!batch.Wait() || !cullingPipelineCreated) return false;
 
 
 
@@ -922,14 +1526,15 @@ bool RenderEngine::InitImgui()
     init_info.QueueFamily = _graphicsQueueFamily;
     init_info.Queue = _graphicsQueue;
     // Optional
-    init_info.PipelineCache = nullptr;
+    init_info.PipelineCache = _pipelineCache.GetHandle();
     // Using `DescriptorPoolSize` instead which lets imgui make its own descriptor pool
     init_info.DescriptorPool = nullptr;
     // This needs to be increased if we do ImGui_ImplVulkan_AddTexture()
     init_info.DescriptorPoolSize = IMGUI_IMPL_VULKAN_MINIMUM_IMAGE_SAMPLER_POOL_SIZE;
     init_info.Subpass = 0;
-    init_info.MinImageCount = 3;
-    init_info.ImageCount = 3;
+    init_info.ImageCount = static_cast<uint32_t>(_swapchainImages.size());
+    // The surface may provide fewer images than requested
+    init_info.MinImageCount = std::min(_config.swapchainImageCount, init_info.ImageCount);
     init_info.MSAASamples = VK_SAMPLE_COUNT_1_BIT;
     init_info.Allocator = nullptr; // Optional
     init_info.UseDynamicRendering = true;
@@ -956,15 +1561,32 @@ bool RenderEngine::InitImgui()
 
 VkExtent2D RenderEngine::GetWindowExtent() const
 {
+    if (_headless) return _headlessExtent;
+
+    // Pixels rather than points, so it can be compared against the swapchain extent on high DPI displays
     int width, height;
-    SDL_GetWindowSize(_window, &width, &height);
+    SDL_GetWindowSizeInPixels(_window, &width, &height);
     return VkExtent2D{
         static_cast<uint32_t>(width), 
         static_cast<uint32_t>(height)
     };
 }
 
-void RenderEngine::CreateSwapchain(const VkExtent2D extent)
+VkExtent2D RenderEngine::GetDisplayExtent() const
+{
+    if (_headless) return _headlessExtent;
+
+    const SDL_DisplayID display = SDL_GetDisplayForWindow(_window);
+    const SDL_DisplayMode* mode = (display != 0) ? SDL_GetDesktopDisplayMode(display) : nullptr;
+    if (mode == nullptr) return GetWindowExtent();
+
+    return VkExtent2D{
+        static_cast<uint32_t>(std::ceil(mode->w * mode->pixel_density)),
+        static_cast<uint32_t>(std::ceil(mode->h * mode->pixel_density))
+    };
+}
+
+bool RenderEngine::CreateSwapchain(const VkExtent2D extent, const VkSwapchainKHR oldSwapchain /* = VK_NULL_HANDLE*/)
 {
     vkb::SwapchainBuilder swapchainBuilder{ _chosenGPU, _device, _surface };
 
@@ -974,20 +1596,37 @@ void RenderEngine::CreateSwapchain(const VkExtent2D extent)
     surfaceFormat.format = _swapchainImageFormat;
     surfaceFormat.colorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
 
-    auto swapchainResult = swapchainBuilder
+    swapchainBuilder
         .set_desired_format(surfaceFormat)
-        // Using v-sync present mode
-        .set_desired_present_mode(VK_PRESENT_MODE_FIFO_KHR)
+        .set_desired_present_mode(_config.presentMode)
+        .set_desired_min_image_count(_config.swapchainImageCount)
         .set_desired_extent(extent.width, extent.height)
         .add_image_usage_flags(VK_IMAGE_USAGE_TRANSFER_DST_BIT)
-        .build()
+        .set_old_swapchain(oldSwapchain)
         ;
 
+    // Fall back to the closest behaviour, FIFO is last as it is the only mode guaranteed to be supported
+    switch (_config.presentMode)
+    {
+        case VK_PRESENT_MODE_MAILBOX_KHR:
+            swapchainBuilder.add_fallback_present_mode(VK_PRESENT_MODE_IMMEDIATE_KHR);
+            break;
+        case VK_PRESENT_MODE_IMMEDIATE_KHR:
+            swapchainBuilder.add_fallback_present_mode(VK_PRESENT_MODE_MAILBOX_KHR);
+            break;
+        case VK_PRESENT_MODE_FIFO_RELAXED_KHR:
+        default:
+            break;
+    }
+    swapchainBuilder.add_fallback_present_mode(VK_PRESENT_MODE_FIFO_KHR);
+
+    auto swapchainResult = swapchainBuilder.build();
+
     // Check if swapchain creation was successful before proceeding
     if (!swapchainResult)
     {
         std::cerr << "Failed to create a swapchain. Error: " << swapchainResult.error().message() << std::endl;
-        return;
+        return false;
     }
     
     vkb::Swapchain vkbSwapchain = swapchainResult.value();
@@ -997,6 +1636,49 @@ void RenderEngine::CreateSwapchain(const VkExtent2D extent)
     _swapchain = vkbSwapchain.swapchain;
     _swapchainImages = vkbSwapchain.get_images().value();
     _swapchainImageViews = vkbSwapchain.get_image_views().value();
+    _presentMode = vkbSwapchain.present_mode;
+    _swapchainImageStates.assign(_swapchainImages.size(), ImageState{});
+
+    return true;
+}
+
+bool RenderEngine::RecreateSwapchain()
+{
+    const VkExtent2D windowExtent = GetWindowExtent();
+    if (windowExtent.width == 0 || windowExtent.height == 0) return false;
+
+    const VkSwapchainKHR oldSwapchain = _swapchain;
+    std::vector<VkImageView> oldImageViews = _swapchainImageViews;
+    std::vector<VkSemaphore> oldRenderSemaphores = _renderSemaphores;
+
+    if (!CreateSwapchain(windowExtent, oldSwapchain)) return false;
+
+    // Frames still in flight may be presenting the old images, so rather than waiting for the device
+    // to idle, retire them once the GPU finished the frame being recorded. Queued before anything
+    // else can fail, the new swapchain already replaced the old one
+    _retiredDeletionQueue.PushDeleter([=]() {
+        for (const VkSemaphore semaphore : oldRenderSemaphores)
+        {
+            vkDestroySemaphore(_device, semaphore, nullptr);
+        }
+        for (const VkImageView imageView : oldImageViews)
+        {
+            vkDestroyImageView(_device, imageView, nullptr);
+        }
+        vkDestroySwapchainKHR(_device, oldSwapchain, nullptr);
+    }, GetRecordingFrameValue());
+
+    // Render semaphores are tied to swapchain image indices, and the image count may have changed.
+    // On failure the swapchain stays dirty, the next attempt retires the semaphores created so far
+    if (!InitRenderSemaphores()) return false;
+
+    // Same count as given to ImGui_ImplVulkan_Init(), ImGui keeps it when unchanged
+    const uint32_t imageCount = static_cast<uint32_t>(_swapchainImages.size());
+    ImGui_ImplVulkan_SetMinImageCount(std::min(_config.swapchainImageCount, imageCount));
+
+    _swapchainDirty = false;
+
+    return true;
 }
 
 void RenderEngine::CleanupSwapchain()
@@ -1010,29 +1692,32 @@ void RenderEngine::CleanupSwapchain()
     }
 }
 
-bool RenderEngine::InitBackgroundPipeline()
+bool RenderEngine::InitBackgroundPipeline(ShaderProgramBatch& batch)
 {
     auto gradientProgram = std::make_unique<ComputeShaderProgram>();
     gradientProgram->SetComputeShader(ComputeShader::FromFile("internal/shaders/gradient_color.comp.spv"));
     gradientProgram->SetDescriptor(_drawImageDescriptorLayout, _drawImageDescriptors);
     gradientProgram->ConfigurePushConstants<ComputePushConstants>();
-    gradientProgram->Init(_device);
 
     auto skyProgram = std::make_unique<ComputeShaderProgram>();
     skyProgram->SetComputeShader(ComputeShader::FromFile("internal/shaders/sky.comp.spv"));
     skyProgram->SetDescriptor(_drawImageDescriptorLayout, _drawImageDescriptors);
     skyProgram->ConfigurePushConstants<ComputePushConstants>();
-    skyProgram->Init(_device);
 
     auto fourColorGradientProgram = std::make_unique<ComputeShaderProgram>();
     fourColorGradientProgram->SetComputeShader(ComputeShader::FromFile("internal/shaders/4_color_gradient.comp.spv"));
     fourColorGradientProgram->SetDescriptor(_drawImageDescriptorLayout, _drawImageDescriptors);
     fourColorGradientProgram->ConfigurePushConstants<ComputePushConstants>();
-    fourColorGradientProgram->Init(_device);
 
     _backgroundEffects.push_back(std::move(gradientProgram));
     _backgroundEffects.push_back(std::move(skyProgram));
     _backgroundEffects.push_back(std::move(fourColorGradientProgram));
+
+    // Queued once owned by the engine, so a throwing shader load cannot free a program being compiled
+    for (const std::unique_ptr<ComputeShaderProgram>& effect : _backgroundEffects)
+    {
+        batch.Add(*effect);
+    }
     
     _mainDeletionQueue.PushDeleter([&](){
         _backgroundEffects.clear();
@@ -1041,39 +1726,60 @@ bool RenderEngine::InitBackgroundPipeline()
     return true;
 }
 
-FrameData& RenderEngine::GetCurrentFrame()
+bool RenderEngine::InitCullingPipeline()
 {
-    return _frames[_frameNumber % FRAME_OVERLAP];
+    if (!_config.indirectDraw || !_config.gpuCulling) return true;
+
+#ifdef VELECS_GRAPHICS_NO_INTERNAL_SHADERS
+    // Built without glslc, the culling shader does not exist
+    std::cerr << "WARNING: GPU culling requested but the internal shaders were not compiled, GPU culling is disabled" << std::endl;
+    _config.gpuCulling = false;
+    return true;
+#endif
+
+    if (!_gpuCuller.Init(_device, &_pipelineCache, &_shaderModuleCache, &_pipelineLayoutCache)) return false;
+
+    _mainDeletionQueue.PushDeleter([&](){
+        _gpuCuller.Cleanup();
+    });
+
+    return true;
 }
 
-void RenderEngine::TransitionImage(
-    const VkCommandBuffer cmd,
-    const VkImage image,
-    const VkImageLayout currentLayout,
-    const VkImageLayout newLayout
-)
+void RenderEngine::CompileRasterizationShaderProgramAsync(RasterizationShaderProgram& program)
 {
-    VkImageMemoryBarrier2 imageBarrier{};
-    imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
-    imageBarrier.pNext = nullptr;
-    imageBarrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
-    imageBarrier.srcAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT;
-    imageBarrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
-    imageBarrier.dstAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT | VK_ACCESS_2_MEMORY_READ_BIT;
-    imageBarrier.oldLayout = currentLayout;
-    imageBarrier.newLayout = newLayout;
-    VkImageAspectFlags aspectMask = (newLayout == VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL)
-        ? VK_IMAGE_ASPECT_DEPTH_BIT
-        : VK_IMAGE_ASPECT_COLOR_BIT;
-    imageBarrier.subresourceRange = VkExtImageSubresourceRange(aspectMask);
-    imageBarrier.image = image;
+    const VkFormat colorAttachmentFormat = _drawImage.imageFormat;
+    const VkDescriptorSetLayout bindlessLayout = _bindlessHeap.GetDescriptorSetLayout();
 
-    VkDependencyInfo depInfo{};
-    depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
-    depInfo.pNext = nullptr;
-    depInfo.imageMemoryBarrierCount = 1;
-    depInfo.pImageMemoryBarriers = &imageBarrier;
-    vkCmdPipelineBarrier2(cmd, &depInfo);
+    _pipelineCompileWorkers.Submit([this, &program, colorAttachmentFormat, bindlessLayout]() {
+        try
+        {
+            program.Init(
+                _device,
+                colorAttachmentFormat,
+                bindlessLayout,
+                &_pipelineCache,
+                &_shaderModuleCache,
+                &_pipelineLayoutCache,
+                &_pipelineStateCache
+            );
+        }
+        catch (const std::exception& e)
+        {
+            // The program is never drawn, the render thread is not interrupted
+            std::cerr << "Failed to compile rasterization shader program: " << e.what() << std::endl;
+        }
+    });
+}
+
+FrameData& RenderEngine::GetCurrentFrame()
+{
+    return _frames[GetFrameIndex(_frameNumber)];
+}
+
+size_t RenderEngine::GetFrameIndex(const size_t frameNumber) const
+{
+    return frameNumber % _frames.size();
 }
 
 void RenderEngine::CopyImageToImage(
@@ -1119,6 +1825,219 @@ void RenderEngine::CopyImageToImage(
     vkCmdBlitImage2(cmd, &blitInfo);
 }
 
+void RenderEngine::CopyImageToBuffer(
+    const VkCommandBuffer cmd,
+    const VkImage source,
+    const VkBuffer destination,
+    const VkExtent2D srcSize
+)
+{
+    // Zero row length and image height means tightly packed rows
+    VkBufferImageCopy2 copyRegion{};
+    copyRegion.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2;
+    copyRegion.pNext = nullptr;
+    copyRegion.bufferOffset = 0;
+    copyRegion.bufferRowLength = 0;
+    copyRegion.bufferImageHeight = 0;
+
+    copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copyRegion.imageSubresource.baseArrayLayer = 0;
+    copyRegion.imageSubresource.layerCount = 1;
+    copyRegion.imageSubresource.mipLevel = 0;
+
+    copyRegion.imageOffset = { 0, 0, 0 };
+    copyRegion.imageExtent = { srcSize.width, srcSize.height, 1 };
+
+    VkCopyImageToBufferInfo2 copyInfo{};
+    copyInfo.sType = VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2;
+    copyInfo.pNext = nullptr;
+    copyInfo.srcImage = source;
+    copyInfo.srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    copyInfo.dstBuffer = destination;
+    copyInfo.regionCount = 1;
+    copyInfo.pRegions = &copyRegion;
+
+    vkCmdCopyImageToBuffer2(cmd, &copyInfo);
+
+    // Make the transfer write visible to host reads once the frame completed
+    VkMemoryBarrier2 hostBarrier{};
+    hostBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+    hostBarrier.pNext = nullptr;
+    hostBarrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+    hostBarrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    hostBarrier.dstStageMask = VK_PIPELINE_STAGE_2_HOST_BIT;
+    hostBarrier.dstAccessMask = VK_ACCESS_2_HOST_READ_BIT;
+
+    VkDependencyInfo depInfo{};
+    depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    depInfo.pNext = nullptr;
+    depInfo.memoryBarrierCount = 1;
+    depInfo.pMemoryBarriers = &hostBarrier;
+    vkCmdPipelineBarrier2(cmd, &depInfo);
+}
+
+VkDeviceSize RenderEngine::GetTexelSize(const VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            return 4;
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            return 8;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return 16;
+        default:
+            throw std::runtime_error("Unsupported texel format for readback.");
+    }
+}
+
+bool RenderEngine::BuildRenderGraph(Scene* const scene, const uint32_t swapchainImageIndex)
+{
+    _renderGraph.Reset();
+    const RenderGraphImage drawImage = _renderGraph.ImportImage("DrawImage", _drawImage);
+
+    // The background overwrites the whole draw extent, so the previous frame's contents are discarded
+    _renderGraph.AddPass("Background", RenderQueue::AsyncCompute)
+        .Write(drawImage, ImageUsage::ComputeStorageWrite, true)
+        .SetExecute([this](const VkCommandBuffer cmd) {
+            DrawBackground(cmd);
+        });
+
+    if (_config.indirectDraw && _config.gpuCulling)
+    {
+        // Writes no image, the geometry pass reads its buffers after the barrier it records
+        _renderGraph.AddPass("Cull")
+            .SetSideEffects()
+            .SetExecute([this, scene](const VkCommandBuffer cmd) {
+                CullGeometry(cmd, scene);
+            });
+    }
+
+    _renderGraph.AddPass("Geometry")
+        .Write(drawImage, ImageUsage::ColorAttachment)
+        .SetExecute([this, scene](const VkCommandBuffer cmd) {
+            DrawGeometry(cmd, scene);
+        });
+
+    if (_headless)
+    {
+        // No swapchain to present to, copy the draw image into this frame's readback buffer instead
+        const VkBuffer readbackBuffer = GetCurrentFrame().readbackBuffer->buffer;
+        _renderGraph.AddPass("Readback")
+            .Read(drawImage, ImageUsage::CopySrc)
+            .SetSideEffects()
+            .SetExecute([this, drawImage, readbackBuffer](const VkCommandBuffer cmd) {
+                CopyImageToBuffer(cmd, _renderGraph.GetImage(drawImage), readbackBuffer, _drawExtent);
+            });
+    }
+    else
+    {
+        // The presentation engine is done with the image once the acquire semaphore is signaled,
+        // which the submission waits on at the stage of the image's first use
+        ImageState& swapchainImageState = _swapchainImageStates[swapchainImageIndex];
+        swapchainImageState = ImageState{};
+        swapchainImageState.stages = SWAPCHAIN_ACQUIRE_WAIT_STAGE;
+
+        const RenderGraphImage swapchainImage = _renderGraph.ImportImage(
+            "SwapchainImage",
+            _swapchainImages[swapchainImageIndex],
+            _swapchainImageViews[swapchainImageIndex],
+            swapchainImageState
+        );
+
+        // The blit covers the whole swapchain image so its previous contents are discarded
+        _renderGraph.AddPass("Blit")
+            .Read(drawImage, ImageUsage::BlitSrc)
+            .Write(swapchainImage, ImageUsage::BlitDst, true)
+            .SetExecute([this, drawImage, swapchainImage](const VkCommandBuffer cmd) {
+                CopyImageToImage(cmd, _renderGraph.GetImage(drawImage), _renderGraph.GetImage(swapchainImage), _drawExtent, _swapchainExtent);
+            });
+
+        _renderGraph.AddPass("ImGui")
+            .Write(swapchainImage, ImageUsage::ColorAttachment)
+            .SetExecute([this, swapchainImage](const VkCommandBuffer cmd) {
+                DrawImgui(cmd, _renderGraph.GetImageView(swapchainImage));
+            });
+
+        _renderGraph.ExportImage(swapchainImage, ImageUsage::Present);
+    }
+
+    if (!_renderGraph.Compile())
+    {
+        std::cerr << "Failed to compile the render graph." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void RenderEngine::DiscardAcquiredImage()
+{
+    if (_headless) return;
+
+    // Consumes the acquire semaphore's signal with an empty batch, so the next acquire into it is valid
+    const VkSemaphoreSubmitInfo waitInfo = VkExtSemaphoreSubmitInfo(
+        SWAPCHAIN_ACQUIRE_WAIT_STAGE,
+        GetCurrentFrame().swapchainSemaphore
+    );
+
+    VkSubmitInfo2 submit = VkExtSubmitInfo2(nullptr, nullptr, &waitInfo);
+    submit.commandBufferInfoCount = 0;
+
+    const VkResult result = vkQueueSubmit2(_graphicsQueue, 1, &submit, VK_NULL_HANDLE);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to discard the acquired swapchain image: " << result << std::endl;
+    }
+
+    // The image is never presented, recreating the swapchain gives it back to the presentation engine
+    _swapchainDirty = true;
+}
+
+bool RenderEngine::SubmitAsyncCompute(const VkCommandBuffer computeCmd)
+{
+    VkResult result = vkEndCommandBuffer(computeCmd);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to end compute command buffer recording: " << result << std::endl;
+        return false;
+    }
+
+    VkCommandBufferSubmitInfo cmdInfo = VkExtCommandBufferSubmitInfo(computeCmd);
+
+    // A failed graphics submission may have left the last value unwaited, signaled values must still increase
+    const uint64_t computeValue = _computeTimelineValue + 1;
+    VkSemaphoreSubmitInfo signalInfo = VkExtSemaphoreSubmitInfo(
+        VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        _computeTimeline,
+        computeValue
+    );
+
+    // The previous frame's graphics work may still read images the compute passes overwrite
+    VkSemaphoreSubmitInfo waitInfo{};
+    const bool waitOnGraphics = _frameNumber > 0;
+    if (waitOnGraphics)
+    {
+        waitInfo = VkExtSemaphoreSubmitInfo(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, _graphicsTimeline, static_cast<uint64_t>(_frameNumber));
+    }
+
+    VkSubmitInfo2 submit = VkExtSubmitInfo2(&cmdInfo, &signalInfo, waitOnGraphics ? &waitInfo : nullptr);
+
+    // Completion is tracked by the graphics timeline, the graphics submission waits on this one
+    result = vkQueueSubmit2(_computeQueue, 1, &submit, VK_NULL_HANDLE);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to submit to compute queue: " << result << std::endl;
+        return false;
+    }
+
+    _computeTimelineValue = computeValue;
+    return true;
+}
+
 void RenderEngine::DrawBackground(const VkCommandBuffer cmd)
 {
     // // Make a clear-color from frame number. This will flash with a 120 frame period.
@@ -1143,6 +2062,47 @@ void RenderEngine::DrawBackground(const VkCommandBuffer cmd)
 
 void RenderEngine::DrawGeometry(const VkCommandBuffer cmd, Scene* const scene)
 {
+    if (_config.indirectDraw)
+    {
+        // With GPU culling the draws were prepared by the cull pass
+        if (!_config.gpuCulling) PrepareIndirectDraws(scene, false);
+        DrawGeometryIndirect(cmd);
+        return;
+    }
+
+    GatherRenderObjects(scene);
+    if (_config.cpuCulling) CullRenderObjects(scene);
+    SortRenderObjects(scene);
+    BuildInstanceGroups(_config.instancing);
+
+    FrameData& frame = GetCurrentFrame();
+
+    const bool instancesWritten = !_config.instancing || WriteInstances(frame.instances);
+    if (!instancesWritten)
+    {
+        std::cerr << "Failed to write instances, skipping draws for this frame." << std::endl;
+    }
+
+    // Split the draws into contiguous ranges, one per recording thread, so the
+    // secondary command buffers can be executed in the same order as the render list
+    const size_t drawCount = instancesWritten ? _instanceGroups.size() : 0;
+    const size_t maxTaskCount = frame.workerCommandBuffers.size();
+    const size_t taskCount = std::min(maxTaskCount, (drawCount + MIN_DRAWS_PER_RECORDING_TASK - 1) / MIN_DRAWS_PER_RECORDING_TASK);
+    const size_t drawsPerTask = taskCount > 0 ? (drawCount + taskCount - 1) / taskCount : 0;
+
+    std::vector<uint8_t> recorded(taskCount, false);
+    _workerPool.ParallelFor(taskCount, [&](const size_t task) {
+        const size_t begin = task * drawsPerTask;
+        const size_t end = std::min(drawCount, begin + drawsPerTask);
+        recorded[task] = RecordGeometry(frame.workerCommandBuffers[task], frame.workerCommandPools[task], begin, end);
+    });
+
+    const bool allRecorded = std::all_of(recorded.begin(), recorded.end(), [](const uint8_t ok) { return ok; });
+    if (!allRecorded)
+    {
+        std::cerr << "Failed to record geometry, skipping draws for this frame." << std::endl;
+    }
+
     // Begin a render pass connected to our draw image
     VkRenderingAttachmentInfo colorAttachment = VkExtRenderingAttachmentInfo(
         _drawImage.imageView,
@@ -1150,21 +2110,569 @@ void RenderEngine::DrawGeometry(const VkCommandBuffer cmd, Scene* const scene)
         VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
     );
 
-    VkRenderingInfo renderInfo = VkExtRenderingInfo(_drawExtent, &colorAttachment, nullptr);
+    const bool executeSecondaries = taskCount > 0 && allRecorded;
+
+    // Only vkCmdExecuteCommands may be recorded inside a render pass begun with secondary contents
+    VkRenderingInfo renderInfo = VkExtRenderingInfo(
+        _drawExtent,
+        &colorAttachment,
+        nullptr,
+        executeSecondaries ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0
+    );
     vkCmdBeginRendering(cmd, &renderInfo);
 
-    scene->Query<MeshRenderer, Transform>([](auto entity, auto& renderer, auto& transform){
-        if (renderer.mesh && renderer.mat)
+    if (executeSecondaries)
+    {
+        vkCmdExecuteCommands(cmd, static_cast<uint32_t>(taskCount), frame.workerCommandBuffers.data());
+    }
+
+    vkCmdEndRendering(cmd);
+}
+
+void RenderEngine::GatherRenderObjects(Scene* const scene)
+{
+    // The scene is not thread safe, so it is only queried on the render thread
+    _renderObjects.clear();
+
+    scene->Query<MeshRenderer, Transform>([this](auto entity, auto& renderer, auto& transform){
+        if (!renderer.mesh || !renderer.mat) return;
+
+        const RasterizationShaderProgram* const program = renderer.mat->GetShaderProgram();
+        // Programs registered asynchronously are drawn once their pipeline was compiled
+        if (program == nullptr || !program->IsPipelineReady()) return;
+
+        if (!renderer.mesh->IsIndexed()) return;
+
+        // Changed meshes are drawn again once their new buffers reached the graphics queue
+        // Copies of a discarded upload batch never happen, so the mesh is uploaded again
+        if (_uploadContext.IsFailed(renderer.mesh->GetUploadTicket())) renderer.mesh->MarkDirty();
+        if (renderer.mesh->IsDirty()) UploadMesh(*renderer.mesh);
+        if (renderer.mesh->GetIndexBuffer() == VK_NULL_HANDLE) return;
+        if (!_uploadContext.IsReady(renderer.mesh->GetUploadTicket())) return;
+
+        _renderObjects.push_back(RenderObject{renderer.mesh.get(), program, renderer.mat.get(), transform.GetWorldMatrix()});
+    });
+}
+
+void RenderEngine::SortRenderObjects(Scene* const scene)
+{
+    const size_t objectCount = _renderObjects.size();
+    if (objectCount < 2) return;
+
+    // Without a camera every draw is at the same depth and only state is sorted
+    float cameraPosition[3]{0.0f, 0.0f, 0.0f};
+    const Camera* const camera = FindActiveCamera(scene);
+    if (camera != nullptr)
+    {
+        float view[16];
+        std::memcpy(view, &camera->GetViewMatrix(), sizeof(view));
+
+        // The view matrix is a rigid transform, its inverse translation is -R^T * t
+        for (int i{0}; i < 3; ++i)
+        {
+            cameraPosition[i] = -(view[i * 4 + 0] * view[12] + view[i * 4 + 1] * view[13] + view[i * 4 + 2] * view[14]);
+        }
+    }
+
+    // Dense ids keep the key fields small, they are assigned in gather order so sorting is deterministic
+    _pipelineSortIds.clear();
+    _materialSortIds.clear();
+    _meshSortIds.clear();
+    auto getSortId = [](std::unordered_map<const void*, uint32_t>& ids, const void* const object) {
+        return ids.try_emplace(object, static_cast<uint32_t>(ids.size())).first->second;
+    };
+
+    _drawPackets.resize(objectCount);
+    for (size_t i{0}; i < objectCount; ++i)
+    {
+        const RenderObject& object = _renderObjects[i];
+
+        const float* const center = object.mesh->GetBounds().center;
+        float w[16];
+        std::memcpy(w, &object.worldMatrix, sizeof(w));
+
+        float distanceSquared{0.0f};
+        for (int r{0}; r < 3; ++r)
+        {
+            const float worldCenter = w[0 * 4 + r] * center[0] + w[1 * 4 + r] * center[1] + w[2 * 4 + r] * center[2] + w[3 * 4 + r];
+            const float delta = worldCenter - cameraPosition[r];
+            distanceSquared += delta * delta;
+        }
+
+        // Materials have no blend state yet, so every draw is opaque
+        _drawPackets[i].key = DrawPacket::MakeKey(
+            DrawPass::Opaque,
+            getSortId(_pipelineSortIds, object.program),
+            getSortId(_materialSortIds, object.material),
+            getSortId(_meshSortIds, object.mesh),
+            distanceSquared
+        );
+        _drawPackets[i].object = static_cast<uint32_t>(i);
+    }
+
+    _drawSorter.Sort(_drawPackets, _workerPool);
+
+    _sortedRenderObjects.resize(objectCount);
+    for (size_t i{0}; i < objectCount; ++i)
+    {
+        _sortedRenderObjects[i] = _renderObjects[_drawPackets[i].object];
+    }
+    _renderObjects.swap(_sortedRenderObjects);
+}
+
+void RenderEngine::BuildInstanceGroups(const bool mergeInstances)
+{
+    _instanceGroups.clear();
+
+    // Sorted draws sharing a program, a material and a mesh are adjacent
+    for (size_t i{0}; i < _renderObjects.size(); ++i)
+    {
+        const RenderObject& object = _renderObjects[i];
+        if (mergeInstances && !_instanceGroups.empty())
         {
-            std::cout << entity->GetName() << std::endl;
+            const RenderObject& first = _renderObjects[_instanceGroups.back().firstObject];
+            if (first.program == object.program && first.material == object.material && first.mesh == object.mesh)
+            {
+                ++_instanceGroups.back().instanceCount;
+                continue;
+            }
+        }
+
+        _instanceGroups.push_back(InstanceGroup{static_cast<uint32_t>(i), 1});
+    }
+}
+
+bool RenderEngine::WriteInstances(InstanceBuffer& instances)
+{
+    // The frame slot was waited on in Draw(), so the buffer can be rewritten or grown
+    if (!instances.Reserve(_device, _allocator, _renderObjects.size())) return false;
+    if (_renderObjects.empty()) return true;
+
+    ObjectData* const objects = instances.GetInstances();
+
+    const size_t objectCount = _renderObjects.size();
+    const size_t taskCount = std::min<size_t>(
+        _workerPool.GetThreadCount() + 1,
+        (objectCount + MIN_DRAWS_PER_RECORDING_TASK - 1) / MIN_DRAWS_PER_RECORDING_TASK
+    );
+    const size_t objectsPerTask = (objectCount + taskCount - 1) / taskCount;
+
+    // Only the fields read by vertex shaders, the rest is for culling
+    _workerPool.ParallelFor(taskCount, [&](const size_t task) {
+        const size_t begin = task * objectsPerTask;
+        const size_t end = std::min(objectCount, begin + objectsPerTask);
+        for (size_t i{begin}; i < end; ++i)
+        {
+            const RenderObject& object = _renderObjects[i];
+            objects[i].worldMatrix = object.worldMatrix;
+            objects[i].vertexBuffer = object.mesh->GetVertexBufferAddress();
+            objects[i].bindlessIndex = object.material->GetBindlessIndex();
         }
     });
 
-    // _rasterPrograms[0]->Draw(cmd, _drawExtent);
+    instances.Flush();
+    return true;
+}
+
+void RenderEngine::CullRenderObjects(Scene* const scene)
+{
+    Frustum frustum{};
+    if (!FindCameraFrustum(scene, frustum)) return;
+
+    // Transforming the bounds costs more than testing them, so it is split across the workers too
+    const size_t objectCount = _renderObjects.size();
+    const size_t taskCount = std::min<size_t>(
+        _workerPool.GetThreadCount() + 1,
+        (objectCount + FrustumCuller::MIN_OBJECTS_PER_TASK - 1) / FrustumCuller::MIN_OBJECTS_PER_TASK
+    );
+    const size_t objectsPerTask = taskCount > 0 ? (objectCount + taskCount - 1) / taskCount : 0;
+
+    _cpuCuller.Resize(objectCount);
+    _workerPool.ParallelFor(taskCount, [&](const size_t task) {
+        const size_t begin = task * objectsPerTask;
+        const size_t end = std::min(objectCount, begin + objectsPerTask);
+        for (size_t i{begin}; i < end; ++i)
+        {
+            const RenderObject& object = _renderObjects[i];
+            _cpuCuller.SetBounds(i, object.mesh->GetBounds(), object.worldMatrix);
+        }
+    });
+
+    // Visible indices are ascending, so the list can be compacted in place
+    const std::vector<uint32_t>& visible = _cpuCuller.Cull(frustum, _workerPool);
+    for (size_t i{0}; i < visible.size(); ++i)
+    {
+        _renderObjects[i] = _renderObjects[visible[i]];
+    }
+    _renderObjects.resize(visible.size());
+}
+
+bool RenderEngine::RecordGeometry(const VkCommandBuffer cmd, const VkCommandPool pool, const size_t begin, const size_t end)
+{
+    // The pool's previous use is done, the frame slot was waited on in Draw()
+    VkResult result = vkResetCommandPool(_device, pool, 0);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to reset worker command pool: " << result << std::endl;
+        return false;
+    }
+
+    VkCommandBufferInheritanceRenderingInfo inheritanceRenderingInfo = VkExtCommandBufferInheritanceRenderingInfo(&_drawImage.imageFormat);
+
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.pNext = &inheritanceRenderingInfo;
+
+    VkCommandBufferBeginInfo cmdBeginInfo = VkExtCommandBufferBeginInfo(
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT
+    );
+    cmdBeginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    result = vkBeginCommandBuffer(cmd, &cmdBeginInfo);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to begin secondary command buffer recording: " << result << std::endl;
+        return false;
+    }
+
+    // Dynamic state is not inherited from the primary command buffer
+    SetGeometryViewport(cmd);
+
+    IndirectPushConstant instancePushConstant{};
+    instancePushConstant.objectBuffer = GetCurrentFrame().instances.GetBufferAddress();
+
+    // Draws are sorted by state, so each pipeline and index buffer is bound once per run
+    const RasterizationShaderProgram* boundProgram{nullptr};
+    const Mesh* boundMesh{nullptr};
+    for (size_t i{begin}; i < end; ++i)
+    {
+        const InstanceGroup& group = _instanceGroups[i];
+        const RenderObject& object = _renderObjects[group.firstObject];
+
+        const VkShaderStageFlags pushConstantStages = object.program->GetPushConstantStages();
+        if (object.program != boundProgram)
+        {
+            vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, object.program->GetPipeline());
+            boundProgram = object.program;
+
+            // One bind covers every resource the run's materials reference
+            if (object.program->UsesBindlessHeap())
+            {
+                _bindlessHeap.Bind(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, object.program->GetPipelineLayout());
+            }
+
+            // Instances find their data through the buffer, which is the same for the whole frame
+            if (_config.instancing && pushConstantStages != 0)
+            {
+                vkCmdPushConstants(
+                    cmd,
+                    object.program->GetPipelineLayout(),
+                    pushConstantStages,
+                    0,
+                    sizeof(IndirectPushConstant),
+                    &instancePushConstant
+                );
+            }
+        }
+
+        if (!_config.instancing && pushConstantStages != 0)
+        {
+            ObjectPushConstant pushConstant{};
+            pushConstant.worldMatrix = object.worldMatrix;
+            pushConstant.vertexBuffer = object.mesh->GetVertexBufferAddress();
+            pushConstant.bindlessIndex = object.material->GetBindlessIndex();
+
+            vkCmdPushConstants(
+                cmd,
+                object.program->GetPipelineLayout(),
+                pushConstantStages,
+                0,
+                sizeof(ObjectPushConstant),
+                &pushConstant
+            );
+        }
+
+        if (object.mesh != boundMesh)
+        {
+            vkCmdBindIndexBuffer(cmd, object.mesh->GetIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
+            boundMesh = object.mesh;
+        }
+
+        // Rebinding only moves the dynamic offset to the mesh's block, the set itself is shared
+        if (object.program->UsesUniformRing())
+        {
+            _uniformRing.Bind(
+                cmd,
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                object.program->GetPipelineLayout(),
+                object.program->GetUniformRingSet(),
+                object.mesh->GetModelUniformsOffset()
+            );
+        }
+
+        const uint32_t firstInstance = _config.instancing ? group.firstObject : 0;
+        vkCmdDrawIndexed(cmd, static_cast<uint32_t>(object.mesh->GetIndexCount()), group.instanceCount, 0, 0, firstInstance);
+    }
+
+    result = vkEndCommandBuffer(cmd);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to end secondary command buffer recording: " << result << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void RenderEngine::BuildDrawBuckets()
+{
+    _drawBuckets.clear();
+
+    // Sorted draws sharing a pipeline and an index buffer are adjacent, each run becomes one indirect call
+    for (size_t i{0}; i < _renderObjects.size(); ++i)
+    {
+        const RenderObject& object = _renderObjects[i];
+        if (_drawBuckets.empty() || _drawBuckets.back().program != object.program || _drawBuckets.back().mesh != object.mesh)
+        {
+            _drawBuckets.push_back(DrawBucket{object.program, object.mesh, static_cast<uint32_t>(i), 0});
+        }
+        ++_drawBuckets.back().drawCount;
+    }
+}
+
+bool RenderEngine::WriteIndirectDraws(IndirectDrawBuffers& draws, const bool gpuCulled)
+{
+    // The frame slot was waited on in Draw(), so the buffers can be rewritten or grown
+    if (!draws.Reserve(_device, _allocator, _renderObjects.size(), _drawBuckets.size())) return false;
+
+    ObjectData* const objects = draws.GetObjects();
+    VkDrawIndexedIndirectCommand* const commands = draws.GetCommands();
+
+    // Every draw writes its own records, so large scenes are split across the workers
+    const size_t drawCount = _renderObjects.size();
+    const size_t taskCount = std::min<size_t>(
+        _workerPool.GetThreadCount() + 1,
+        (drawCount + MIN_DRAWS_PER_RECORDING_TASK - 1) / MIN_DRAWS_PER_RECORDING_TASK
+    );
+    const size_t drawsPerTask = taskCount > 0 ? (drawCount + taskCount - 1) / taskCount : 0;
+
+    // Bucket of every draw, so workers can fill in the fields read by the culling shader
+    _drawBucketIndices.resize(drawCount);
+    for (size_t i{0}; i < _drawBuckets.size(); ++i)
+    {
+        const DrawBucket& bucket = _drawBuckets[i];
+        std::fill_n(_drawBucketIndices.begin() + bucket.firstDraw, bucket.drawCount, static_cast<uint32_t>(i));
+    }
+
+    _workerPool.ParallelFor(taskCount, [&](const size_t task) {
+        const size_t begin = task * drawsPerTask;
+        const size_t end = std::min(drawCount, begin + drawsPerTask);
+        for (size_t i{begin}; i < end; ++i)
+        {
+            const RenderObject& object = _renderObjects[i];
+            const BoundingVolume& bounds = object.mesh->GetBounds();
+            const uint32_t bucket = _drawBucketIndices[i];
+
+            ObjectData& data = objects[i];
+            data.worldMatrix = object.worldMatrix;
+            std::copy(std::begin(bounds.center), std::end(bounds.center), data.boundsCenter);
+            data.boundsRadius = bounds.radius;
+            std::copy(std::begin(bounds.extents), std::end(bounds.extents), data.boundsExtents);
+            data.indexCount = static_cast<uint32_t>(object.mesh->GetIndexCount());
+            data.vertexBuffer = object.mesh->GetVertexBufferAddress();
+            data.bucket = bucket;
+            data.bucketFirstDraw = _drawBuckets[bucket].firstDraw;
+            data.bindlessIndex = object.material->GetBindlessIndex();
+        }
+    });
+
+    uint32_t* const counts = draws.GetCounts();
+    if (gpuCulled)
+    {
+        // The culling shader writes the commands of visible draws and counts them from zero
+        std::fill_n(counts, _drawBuckets.size(), 0u);
+    }
+    else
+    {
+        // Groups never span buckets, so each bucket's commands are its groups packed at the start of its range
+        uint32_t bucket{0};
+        uint32_t commandCount{0};
+        for (const InstanceGroup& group : _instanceGroups)
+        {
+            if (_drawBucketIndices[group.firstObject] != bucket)
+            {
+                bucket = _drawBucketIndices[group.firstObject];
+                commandCount = 0;
+            }
+
+            // The instance index selects the draw's ObjectData in the vertex shader
+            VkDrawIndexedIndirectCommand& command = commands[_drawBuckets[bucket].firstDraw + commandCount];
+            command.indexCount = objects[group.firstObject].indexCount;
+            command.instanceCount = group.instanceCount;
+            command.firstIndex = 0;
+            command.vertexOffset = 0;
+            command.firstInstance = group.firstObject;
+
+            counts[bucket] = ++commandCount;
+        }
+    }
+
+    draws.Flush();
+    return true;
+}
+
+void RenderEngine::PrepareIndirectDraws(Scene* const scene, const bool gpuCulled)
+{
+    GatherRenderObjects(scene);
+    if (_config.cpuCulling && !gpuCulled) CullRenderObjects(scene);
+    SortRenderObjects(scene);
+    BuildDrawBuckets();
+
+    // Culling tests every draw on its own, so only unculled draws are merged
+    BuildInstanceGroups(!gpuCulled);
+
+    _indirectDrawsReady = !_drawBuckets.empty() && WriteIndirectDraws(GetCurrentFrame().indirectDraws, gpuCulled);
+    if (!_drawBuckets.empty() && !_indirectDrawsReady)
+    {
+        std::cerr << "Failed to write indirect draws, skipping draws for this frame." << std::endl;
+    }
+}
+
+void RenderEngine::CullGeometry(const VkCommandBuffer cmd, Scene* const scene)
+{
+    Frustum frustum{};
+    const bool hasCamera = FindCameraFrustum(scene, frustum);
+
+    // Without a camera there is nothing to cull against, the draws are written unculled
+    PrepareIndirectDraws(scene, hasCamera);
+    if (!_indirectDrawsReady || !hasCamera) return;
+
+    _gpuCuller.Dispatch(cmd, frustum, GetCurrentFrame().indirectDraws, static_cast<uint32_t>(_renderObjects.size()));
+}
+
+bool RenderEngine::FindCameraFrustum(Scene* const scene, Frustum& frustum) const
+{
+    const Camera* const camera = FindActiveCamera(scene);
+    if (camera == nullptr) return false;
+
+    frustum = Frustum::FromCamera(camera->GetProjectionMatrix(), camera->GetViewMatrix());
+    return true;
+}
+
+const Camera* RenderEngine::FindActiveCamera(Scene* const scene) const
+{
+    // The first camera found is the active one
+    const Camera* active{nullptr};
+    scene->Query<PerspectiveCamera>([&](auto entity, auto& camera){
+        if (active == nullptr) active = &camera;
+    });
+    if (active != nullptr) return active;
+
+    scene->Query<OrthographicCamera>([&](auto entity, auto& camera){
+        if (active == nullptr) active = &camera;
+    });
+    return active;
+}
+
+void RenderEngine::DrawGeometryIndirect(const VkCommandBuffer cmd)
+{
+    IndirectDrawBuffers& draws = GetCurrentFrame().indirectDraws;
+    const bool written = _indirectDrawsReady;
+
+    // Begin a render pass connected to our draw image
+    VkRenderingAttachmentInfo colorAttachment = VkExtRenderingAttachmentInfo(
+        _drawImage.imageView,
+        nullptr,
+        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+    );
+    VkRenderingInfo renderInfo = VkExtRenderingInfo(_drawExtent, &colorAttachment, nullptr);
+    vkCmdBeginRendering(cmd, &renderInfo);
+
+    if (written)
+    {
+        SetGeometryViewport(cmd);
+
+        IndirectPushConstant pushConstant{};
+        pushConstant.objectBuffer = draws.GetObjectBufferAddress();
+
+        // The CPU cost scales with the number of buckets, not with the number of draws
+        const RasterizationShaderProgram* boundProgram{nullptr};
+        for (size_t i{0}; i < _drawBuckets.size(); ++i)
+        {
+            const DrawBucket& bucket = _drawBuckets[i];
+
+            if (bucket.program != boundProgram)
+            {
+                vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, bucket.program->GetPipeline());
+                boundProgram = bucket.program;
+
+                if (bucket.program->UsesBindlessHeap())
+                {
+                    _bindlessHeap.Bind(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, bucket.program->GetPipelineLayout());
+                }
+
+                const VkShaderStageFlags pushConstantStages = bucket.program->GetPushConstantStages();
+                if (pushConstantStages != 0)
+                {
+                    vkCmdPushConstants(
+                        cmd,
+                        bucket.program->GetPipelineLayout(),
+                        pushConstantStages,
+                        0,
+                        sizeof(IndirectPushConstant),
+                        &pushConstant
+                    );
+                }
+            }
+
+            vkCmdBindIndexBuffer(cmd, bucket.mesh->GetIndexBuffer(), 0, VK_INDEX_TYPE_UINT32);
+
+            if (bucket.program->UsesUniformRing())
+            {
+                _uniformRing.Bind(
+                    cmd,
+                    VK_PIPELINE_BIND_POINT_GRAPHICS,
+                    bucket.program->GetPipelineLayout(),
+                    bucket.program->GetUniformRingSet(),
+                    bucket.mesh->GetModelUniformsOffset()
+                );
+            }
+
+            vkCmdDrawIndexedIndirectCount(
+                cmd,
+                draws.GetCommandBuffer(),
+                bucket.firstDraw * sizeof(VkDrawIndexedIndirectCommand),
+                draws.GetCountBuffer(),
+                i * sizeof(uint32_t),
+                bucket.drawCount,
+                sizeof(VkDrawIndexedIndirectCommand)
+            );
+        }
+    }
 
     vkCmdEndRendering(cmd);
 }
 
+void RenderEngine::SetGeometryViewport(const VkCommandBuffer cmd) const
+{
+    VkViewport viewport = {};
+    viewport.x = 0;
+    viewport.y = 0;
+    viewport.width = static_cast<float>(_drawExtent.width);
+    viewport.height = static_cast<float>(_drawExtent.height);
+    viewport.minDepth = 0.f;
+    viewport.maxDepth = 1.f;
+
+    vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+    VkRect2D scissor = {};
+    scissor.offset.x = 0;
+    scissor.offset.y = 0;
+    scissor.extent = _drawExtent;
+
+    vkCmdSetScissor(cmd, 0, 1, &scissor);
+}
+
 void RenderEngine::DrawImgui(const VkCommandBuffer cmd, const VkImageView targetImageView)
 {
     VkRenderingAttachmentInfo colorAttachment = VkExtRenderingAttachmentInfo(
@@ -1181,38 +2689,16 @@ void RenderEngine::DrawImgui(const VkCommandBuffer cmd, const VkImageView target
     vkCmdEndRendering(cmd);
 }
 
-void RenderEngine::ImmediateSubmit(std::function<void(VkCommandBuffer)>&& function)
+bool RenderEngine::ImmediateSubmit(std::function<void(VkCommandBuffer)>&& function)
 {
-    // VkCommandBuffer cmd = _uploadContext._commandBuffer;
-    
-    // VkCommandBufferBeginInfo cmdBeginInfo = VkExtCommandBufferBeginInfo(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
-    // VkResult result = vkBeginCommandBuffer(cmd, &cmdBeginInfo);
-    // if (result != VK_SUCCESS)
-    // {
-    //     std::cerr << "Failed to begin command buffer: " << result << std::endl;
-    //     return;
-    // }
-    
-    // function(cmd);
-    
-    // result = vkEndCommandBuffer(cmd);
-    // if (result != VK_SUCCESS)
-    // {
-    //     std::cerr << "Failed to end command buffer: " << result << std::endl;
-    //     return;
-    // }
-    
-    // VkSubmitInfo submit = VkExtSubmitInfo(&cmd);
-    // result = vkQueueSubmit(_graphicsQueue, 1, &submit, _uploadContext._uploadFence);
-    // if (result != VK_SUCCESS)
-    // {
-    //     std::cerr << "Failed to submit to queue: " << result << std::endl;
-    //     return;
-    // }
-    
-    // vkWaitForFences(_device, 1, &_uploadContext._uploadFence, true, 9999999999);
-    // vkResetFences(_device, 1, &_uploadContext._uploadFence);
-    // vkResetCommandPool(_device, _uploadContext._commandPool, 0);
+    // Everything queued so far goes out in the same batch
+    _uploadContext.Record(std::move(function));
+
+    const UploadTicket ticket = _uploadContext.Submit();
+    if (!ticket.IsValid()) return false;
+
+    // Only blocks on the transfer queue, the graphics queue keeps running
+    return _uploadContext.Wait(ticket);
 }
 
 } // namespace velecs::graphics
@@ -0,0 +1,645 @@
+/// @file    RenderGraph.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 14:02:37
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/RenderGraph/RenderGraph.hpp"
+
+#include "velecs/graphics/Profiling/GpuProfiler.hpp"
+#include "velecs/graphics/Sync/ImageBarrierBatch.hpp"
+#include "velecs/graphics/VulkanInitializers.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void RenderGraph::Init(
+    const VkDevice device,
+    const VmaAllocator allocator,
+    const uint32_t graphicsQueueFamily,
+    const uint32_t computeQueueFamily,
+    const uint32_t framesInFlight
+)
+{
+    _device = device;
+    _allocator = allocator;
+    _graphicsQueueFamily = graphicsQueueFamily;
+    _computeQueueFamily = computeQueueFamily;
+    _framesInFlight = std::max(framesInFlight, 1u);
+}
+
+void RenderGraph::Cleanup()
+{
+    Reset();
+
+    for (const auto& physicalImage : _physicalImages)
+    {
+        DestroyPhysicalImage(*physicalImage);
+    }
+    _physicalImages.clear();
+}
+
+void RenderGraph::Reset()
+{
+    _passes.clear();
+    _images.clear();
+}
+
+RenderGraphImage RenderGraph::ImportImage(
+    const std::string& name,
+    const VkImage image,
+    const VkImageView imageView,
+    ImageState& state,
+    const VkImageAspectFlags aspectMask /* = VK_IMAGE_ASPECT_COLOR_BIT*/
+)
+{
+    ImageResource resource{};
+    resource.name = name;
+    resource.transient = false;
+    resource.aspectMask = aspectMask;
+    resource.image = image;
+    resource.imageView = imageView;
+    resource.state = &state;
+
+    _images.push_back(std::move(resource));
+    return RenderGraphImage{static_cast<uint32_t>(_images.size() - 1)};
+}
+
+RenderGraphImage RenderGraph::ImportImage(
+    const std::string& name,
+    AllocatedImage& image,
+    const VkImageAspectFlags aspectMask /* = VK_IMAGE_ASPECT_COLOR_BIT*/
+)
+{
+    return ImportImage(name, image.image, image.imageView, image.state, aspectMask);
+}
+
+RenderGraphImage RenderGraph::CreateTransientImage(const std::string& name, const TransientImageDesc& desc)
+{
+    ImageResource resource{};
+    resource.name = name;
+    resource.transient = true;
+    resource.aspectMask = desc.aspectMask;
+    resource.desc = desc;
+
+    _images.push_back(std::move(resource));
+    return RenderGraphImage{static_cast<uint32_t>(_images.size() - 1)};
+}
+
+void RenderGraph::ExportImage(const RenderGraphImage image, const std::optional<ImageUsage> finalUsage /* = std::nullopt*/)
+{
+    if (!image.IsValid() || image.index >= _images.size())
+        throw std::invalid_argument("Cannot export an invalid render graph image");
+
+    ImageResource& resource = _images[image.index];
+    resource.exported = true;
+    resource.finalUsage = finalUsage;
+}
+
+RenderGraphPass& RenderGraph::AddPass(const std::string& name, const RenderQueue queue /* = RenderQueue::Graphics*/)
+{
+    _passes.push_back(std::make_unique<RenderGraphPass>(name, queue));
+    return *_passes.back();
+}
+
+bool RenderGraph::Compile()
+{
+    CullPasses();
+    ComputeLifetimes();
+    if (!AssignPhysicalImages()) return false;
+
+    // Needs the physical images to know who owns the transient memory
+    AssignQueues();
+    return true;
+}
+
+void RenderGraph::Execute(
+    const VkCommandBuffer cmd,
+    GpuProfiler* const profiler /* = nullptr*/,
+    const VkCommandBuffer computeCmd /* = VK_NULL_HANDLE*/
+)
+{
+    _computeWaitStages = VK_PIPELINE_STAGE_2_NONE;
+
+    // Releases recorded on the compute queue, indexed by GetStateKey()
+    std::vector<PendingAcquire> pendingAcquires(_images.size() + _physicalImages.size());
+
+    // Without a compute command buffer the async passes are recorded with the graphics ones in submission order
+    const bool useComputeQueue = computeCmd != VK_NULL_HANDLE && IsAsyncComputeAvailable();
+    if (useComputeQueue)
+    {
+        ExecuteComputePasses(computeCmd, pendingAcquires);
+    }
+
+    ExecuteGraphicsPasses(cmd, profiler, useComputeQueue, pendingAcquires);
+}
+
+VkImage RenderGraph::GetImage(const RenderGraphImage image) const
+{
+    return GetImage(GetResource(image));
+}
+
+VkImageView RenderGraph::GetImageView(const RenderGraphImage image) const
+{
+    const ImageResource& resource = GetResource(image);
+    if (!resource.transient) return resource.imageView;
+
+    if (resource.physicalIndex >= _physicalImages.size()) return VK_NULL_HANDLE;
+    return _physicalImages[resource.physicalIndex]->image.imageView;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+const uint32_t RenderGraph::NO_PASS = std::numeric_limits<uint32_t>::max();
+
+// Private Methods
+
+void RenderGraph::CullPasses()
+{
+    // Walk the passes backwards, keeping track of which images still have a consumer
+    std::vector<bool> needed(_images.size(), false);
+    for (size_t i{0}; i < _images.size(); ++i)
+    {
+        needed[i] = _images[i].exported;
+    }
+
+    for (size_t passIndex = _passes.size(); passIndex-- > 0;)
+    {
+        RenderGraphPass& pass = *_passes[passIndex];
+
+        bool alive = pass.HasSideEffects();
+        for (const RenderGraphPass::ImageAccess& access : pass.GetImageAccesses())
+        {
+            if (access.write && needed[access.image.index])
+            {
+                alive = true;
+                break;
+            }
+        }
+
+        pass._culled = !alive;
+        if (!alive) continue;
+
+        // Overwriting the whole image makes earlier writers unnecessary, unless something else needs them
+        for (const RenderGraphPass::ImageAccess& access : pass.GetImageAccesses())
+        {
+            if (access.write && access.discard) needed[access.image.index] = false;
+        }
+
+        // Reads, and writes building on previous contents, depend on earlier writers
+        for (const RenderGraphPass::ImageAccess& access : pass.GetImageAccesses())
+        {
+            if (!access.write || !access.discard) needed[access.image.index] = true;
+        }
+    }
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+    for (ImageResource& resource : _images)
+    {
+        resource.firstPass = NO_PASS;
+        resource.lastPass = NO_PASS;
+        resource.written = false;
+    }
+
+    for (uint32_t passIndex{0}; passIndex < _passes.size(); ++passIndex)
+    {
+        const RenderGraphPass& pass = *_passes[passIndex];
+        if (pass.IsCulled()) continue;
+
+        for (const RenderGraphPass::ImageAccess& access : pass.GetImageAccesses())
+        {
+            ImageResource& resource = _images[access.image.index];
+            if (resource.firstPass == NO_PASS) resource.firstPass = passIndex;
+            resource.lastPass = passIndex;
+        }
+    }
+
+    // Exported images must outlive every pass
+    for (ImageResource& resource : _images)
+    {
+        if (resource.exported && resource.firstPass != NO_PASS)
+        {
+            resource.lastPass = static_cast<uint32_t>(_passes.size());
+        }
+    }
+}
+
+bool RenderGraph::AssignPhysicalImages()
+{
+    for (const auto& physicalImage : _physicalImages)
+    {
+        physicalImage->availableAfter = NO_PASS;
+    }
+
+    // Assign in order of first use so an image freed by an earlier lifetime can be picked up by a later one
+    std::vector<uint32_t> transients;
+    for (uint32_t i{0}; i < _images.size(); ++i)
+    {
+        ImageResource& resource = _images[i];
+        resource.physicalIndex = NO_PASS;
+        if (resource.transient && resource.firstPass != NO_PASS) transients.push_back(i);
+    }
+    std::sort(transients.begin(), transients.end(), [this](const uint32_t a, const uint32_t b) {
+        return _images[a].firstPass < _images[b].firstPass;
+    });
+
+    for (const uint32_t imageIndex : transients)
+    {
+        ImageResource& resource = _images[imageIndex];
+
+        for (uint32_t physicalIndex{0}; physicalIndex < _physicalImages.size(); ++physicalIndex)
+        {
+            PhysicalImage& physicalImage = *_physicalImages[physicalIndex];
+            const bool free = physicalImage.availableAfter == NO_PASS || physicalImage.availableAfter < resource.firstPass;
+            if (free && physicalImage.desc == resource.desc)
+            {
+                resource.physicalIndex = physicalIndex;
+                physicalImage.availableAfter = resource.lastPass;
+                break;
+            }
+        }
+
+        if (resource.physicalIndex != NO_PASS) continue;
+
+        auto physicalImage = std::make_unique<PhysicalImage>();
+        if (!CreatePhysicalImage(resource.desc, *physicalImage))
+        {
+            std::cerr << "Failed to create transient image '" << resource.name << "'" << std::endl;
+            return false;
+        }
+        physicalImage->availableAfter = resource.lastPass;
+
+        resource.physicalIndex = static_cast<uint32_t>(_physicalImages.size());
+        _physicalImages.push_back(std::move(physicalImage));
+    }
+
+    TrimPhysicalImages();
+
+    return true;
+}
+
+void RenderGraph::TrimPhysicalImages()
+{
+    // An image unused for as many frames as there are in flight is no longer read by the GPU
+    std::vector<uint32_t> remap(_physicalImages.size(), NO_PASS);
+    size_t kept{0};
+    for (uint32_t physicalIndex{0}; physicalIndex < _physicalImages.size(); ++physicalIndex)
+    {
+        PhysicalImage& physicalImage = *_physicalImages[physicalIndex];
+        physicalImage.unusedFrames = physicalImage.availableAfter == NO_PASS ? physicalImage.unusedFrames + 1 : 0;
+        if (physicalImage.unusedFrames >= _framesInFlight)
+        {
+            DestroyPhysicalImage(physicalImage);
+            continue;
+        }
+
+        remap[physicalIndex] = static_cast<uint32_t>(kept);
+        _physicalImages[kept++] = std::move(_physicalImages[physicalIndex]);
+    }
+    _physicalImages.resize(kept);
+
+    for (ImageResource& resource : _images)
+    {
+        if (resource.physicalIndex != NO_PASS) resource.physicalIndex = remap[resource.physicalIndex];
+    }
+}
+
+void RenderGraph::AssignQueues()
+{
+    for (const auto& pass : _passes)
+    {
+        pass->_asyncCompute = false;
+    }
+
+    if (!IsAsyncComputeAvailable()) return;
+
+    // The compute submission runs before the graphics one, so it cannot see anything
+    // the graphics queue does this frame
+    std::vector<bool> usedOnGraphics(_images.size() + _physicalImages.size(), false);
+    std::vector<bool> usedOnCompute(usedOnGraphics.size(), false);
+
+    for (uint32_t passIndex{0}; passIndex < _passes.size(); ++passIndex)
+    {
+        RenderGraphPass& pass = *_passes[passIndex];
+        if (pass.IsCulled()) continue;
+
+        bool async = pass.GetQueue() == RenderQueue::AsyncCompute;
+        for (const RenderGraphPass::ImageAccess& access : pass.GetImageAccesses())
+        {
+            if (!async) break;
+
+            ImageResource& resource = _images[access.image.index];
+            const size_t key = GetStateKey(resource);
+
+            // Contents produced by the graphics queue would need a release recorded by a previous frame
+            const bool discard = (access.write && access.discard) || (resource.transient && resource.firstPass == passIndex);
+            const uint32_t owner = GetState(resource).queueFamily;
+            const bool ownedByGraphics = owner != VK_QUEUE_FAMILY_IGNORED && owner != _computeQueueFamily;
+
+            // An earlier compute pass of this frame already took the image over
+            const bool available = discard || !ownedByGraphics || usedOnCompute[key];
+
+            if (usedOnGraphics[key] || !available || !IsComputeQueueUsage(access.usage))
+            {
+                async = false;
+            }
+        }
+
+        pass._asyncCompute = async;
+
+        std::vector<bool>& used = async ? usedOnCompute : usedOnGraphics;
+        for (const RenderGraphPass::ImageAccess& access : pass.GetImageAccesses())
+        {
+            used[GetStateKey(_images[access.image.index])] = true;
+        }
+    }
+}
+
+void RenderGraph::ExecuteComputePasses(const VkCommandBuffer cmd, std::vector<PendingAcquire>& pendingAcquires)
+{
+    ImageBarrierBatch barriers{};
+    std::vector<bool> usedOnCompute(pendingAcquires.size(), false);
+
+    for (const auto& pass : _passes)
+    {
+        if (pass->IsCulled() || !pass->IsAsyncCompute()) continue;
+
+        for (const RenderGraphPass::ImageAccess& access : pass->GetImageAccesses())
+        {
+            ImageResource& resource = _images[access.image.index];
+            TransitionForPass(barriers, resource, access, GetQueueFamily(true), pendingAcquires);
+            usedOnCompute[GetStateKey(resource)] = true;
+        }
+        barriers.Flush(cmd);
+
+        pass->Execute(cmd);
+    }
+
+    // Hand every image back to the graphics queue, in the layout of its next graphics use.
+    // Images the graphics queue overwrites without reading do not need to be transferred
+    for (uint32_t imageIndex{0}; imageIndex < _images.size(); ++imageIndex)
+    {
+        ImageResource& resource = _images[imageIndex];
+        if (!HasState(resource)) continue;
+
+        const size_t key = GetStateKey(resource);
+        if (!usedOnCompute[key] || pendingAcquires[key].pending) continue;
+
+        std::optional<ImageUsage> nextUsage;
+        bool nextDiscards = false;
+        for (const auto& pass : _passes)
+        {
+            if (pass->IsCulled() || pass->IsAsyncCompute()) continue;
+
+            for (const RenderGraphPass::ImageAccess& access : pass->GetImageAccesses())
+            {
+                const ImageResource& other = _images[access.image.index];
+                if (GetStateKey(other) != key) continue;
+
+                nextUsage = access.usage;
+                nextDiscards = access.discard || (other.transient && &other != &resource);
+                break;
+            }
+            if (nextUsage.has_value()) break;
+        }
+
+        if (nextDiscards) continue;
+        if (!nextUsage.has_value()) nextUsage = resource.finalUsage;
+
+        ImageState& state = GetState(resource);
+        const VkImageLayout oldLayout = state.layout;
+        const VkImageLayout newLayout = nextUsage.has_value() ? ImageState::FromUsage(nextUsage.value()).layout : state.layout;
+
+        barriers.Release(GetImage(resource), state, _graphicsQueueFamily, newLayout, resource.aspectMask);
+
+        pendingAcquires[key].pending = true;
+        pendingAcquires[key].oldLayout = oldLayout;
+    }
+    barriers.Flush(cmd);
+}
+
+void RenderGraph::ExecuteGraphicsPasses(
+    const VkCommandBuffer cmd,
+    GpuProfiler* const profiler,
+    const bool skipAsyncCompute,
+    std::vector<PendingAcquire>& pendingAcquires
+)
+{
+    ImageBarrierBatch barriers{};
+    const uint32_t queueFamily = GetQueueFamily(false);
+
+    for (const auto& pass : _passes)
+    {
+        if (pass->IsCulled() || (skipAsyncCompute && pass->IsAsyncCompute())) continue;
+
+        for (const RenderGraphPass::ImageAccess& access : pass->GetImageAccesses())
+        {
+            TransitionForPass(barriers, _images[access.image.index], access, queueFamily, pendingAcquires);
+        }
+        barriers.Flush(cmd);
+
+        if (profiler != nullptr)
+        {
+            GpuProfileScope scope{*profiler, cmd, pass->GetName()};
+            pass->Execute(cmd);
+        }
+        else
+        {
+            pass->Execute(cmd);
+        }
+    }
+
+    for (ImageResource& resource : _images)
+    {
+        if (!HasState(resource)) continue;
+
+        const size_t key = GetStateKey(resource);
+        ImageState& state = GetState(resource);
+
+        if (pendingAcquires[key].pending)
+        {
+            // Released by the compute queue but not used by a graphics pass, finish the transfer here
+            ImageState newState = resource.finalUsage.has_value() ? ImageState::FromUsage(resource.finalUsage.value()) : state;
+            newState.layout = state.layout;
+            newState.stages = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            newState.queueFamily = queueFamily;
+
+            barriers.Acquire(GetImage(resource), state, _computeQueueFamily, pendingAcquires[key].oldLayout, newState, resource.aspectMask);
+            _computeWaitStages |= newState.stages;
+            pendingAcquires[key].pending = false;
+            continue;
+        }
+
+        if (!resource.exported || !resource.finalUsage.has_value()) continue;
+
+        ImageState finalState = ImageState::FromUsage(resource.finalUsage.value());
+        finalState.queueFamily = queueFamily;
+        barriers.Transition(GetImage(resource), state, finalState, false, resource.aspectMask);
+    }
+    barriers.Flush(cmd);
+}
+
+void RenderGraph::TransitionForPass(
+    ImageBarrierBatch& barriers,
+    ImageResource& resource,
+    const RenderGraphPass::ImageAccess& access,
+    const uint32_t queueFamily,
+    std::vector<PendingAcquire>& pendingAcquires
+)
+{
+    const size_t key = GetStateKey(resource);
+    ImageState& state = GetState(resource);
+
+    ImageState newState = ImageState::FromUsage(access.usage);
+    newState.queueFamily = queueFamily;
+
+    // Transient contents never survive from a previous frame or a previous image sharing the memory
+    const bool discard = access.discard || (resource.transient && !resource.written);
+    if (access.write) resource.written = true;
+
+    if (pendingAcquires[key].pending)
+    {
+        // The release already moved the image to the layout of this use
+        barriers.Acquire(GetImage(resource), state, _computeQueueFamily, pendingAcquires[key].oldLayout, newState, resource.aspectMask);
+        _computeWaitStages |= newState.stages;
+        pendingAcquires[key].pending = false;
+        return;
+    }
+
+    if (state.queueFamily != VK_QUEUE_FAMILY_IGNORED && state.queueFamily != queueFamily)
+    {
+        // Only reached when discarding, which needs no ownership transfer. The other queue's
+        // accesses are ordered by the semaphores between the submissions, not by this barrier
+        state = ImageState{};
+        if (queueFamily == _graphicsQueueFamily) _computeWaitStages |= newState.stages;
+    }
+
+    barriers.Transition(GetImage(resource), state, newState, discard, resource.aspectMask);
+}
+
+uint32_t RenderGraph::GetQueueFamily(const bool compute) const
+{
+    // Ownership is only tracked when there is more than one queue family
+    if (!IsAsyncComputeAvailable()) return VK_QUEUE_FAMILY_IGNORED;
+    return compute ? _computeQueueFamily : _graphicsQueueFamily;
+}
+
+bool RenderGraph::HasState(const ImageResource& resource) const
+{
+    // Culled transient images are never given memory
+    return !resource.transient || resource.physicalIndex != NO_PASS;
+}
+
+size_t RenderGraph::GetStateKey(const ImageResource& resource) const
+{
+    // Transient images sharing memory share their state
+    if (resource.transient) return _images.size() + resource.physicalIndex;
+    return static_cast<size_t>(&resource - _images.data());
+}
+
+bool RenderGraph::IsComputeQueueUsage(const ImageUsage usage)
+{
+    switch (usage)
+    {
+        case ImageUsage::Undefined:
+        case ImageUsage::ComputeStorageRead:
+        case ImageUsage::ComputeStorageWrite:
+        case ImageUsage::ComputeStorageReadWrite:
+        case ImageUsage::ComputeSampledRead:
+        case ImageUsage::CopySrc:
+        case ImageUsage::CopyDst:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void RenderGraph::DestroyPhysicalImage(PhysicalImage& physicalImage)
+{
+    vkDestroyImageView(_device, physicalImage.image.imageView, nullptr);
+    vmaDestroyImage(_allocator, physicalImage.image.image, physicalImage.image.allocation);
+    physicalImage.image = AllocatedImage{};
+}
+
+bool RenderGraph::CreatePhysicalImage(const TransientImageDesc& desc, PhysicalImage& physicalImage)
+{
+    physicalImage.desc = desc;
+    physicalImage.image.imageFormat = desc.format;
+    physicalImage.image.imageExtent = desc.extent;
+
+    VkImageCreateInfo imageInfo = VkExtImageCreateInfo(desc.format, desc.extent, desc.usage);
+
+    VmaAllocationCreateInfo allocInfo{};
+    allocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+    allocInfo.requiredFlags = VkMemoryPropertyFlags{VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT};
+
+    VkResult result = vmaCreateImage(
+        _allocator,
+        &imageInfo,
+        &allocInfo,
+        &physicalImage.image.image,
+        &physicalImage.image.allocation,
+        nullptr
+    );
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create render graph image: " << result << std::endl;
+        return false;
+    }
+
+    VkImageViewCreateInfo imageViewInfo = VkExtImageviewCreateInfo(desc.format, physicalImage.image.image, desc.aspectMask);
+
+    result = vkCreateImageView(_device, &imageViewInfo, nullptr, &physicalImage.image.imageView);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "Failed to create render graph image view: " << result << std::endl;
+        vmaDestroyImage(_allocator, physicalImage.image.image, physicalImage.image.allocation);
+        return false;
+    }
+
+    return true;
+}
+
+const RenderGraph::ImageResource& RenderGraph::GetResource(const RenderGraphImage image) const
+{
+    if (!image.IsValid() || image.index >= _images.size())
+        throw std::out_of_range("Invalid render graph image");
+
+    return _images[image.index];
+}
+
+ImageState& RenderGraph::GetState(ImageResource& resource)
+{
+    if (resource.transient) return _physicalImages[resource.physicalIndex]->image.state;
+    return *resource.state;
+}
+
+VkImage RenderGraph::GetImage(const ImageResource& resource) const
+{
+    if (!resource.transient) return resource.image;
+
+    if (resource.physicalIndex >= _physicalImages.size()) return VK_NULL_HANDLE;
+    return _physicalImages[resource.physicalIndex]->image.image;
+}
+
+} // namespace velecs::graphics
@@ -0,0 +1,81 @@
+/// @file    RenderGraphPass.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:25:58
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/RenderGraph/RenderGraphPass.hpp"
+
+#include <stdexcept>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+RenderGraphPass::RenderGraphPass(const std::string& name, const RenderQueue queue)
+    : _name(name), _queue(queue) {}
+
+// Public Methods
+
+RenderGraphPass& RenderGraphPass::Read(const RenderGraphImage image, const ImageUsage usage)
+{
+    if (!image.IsValid())
+        throw std::invalid_argument("Render graph pass '" + _name + "' reads an invalid image");
+
+    ImageAccess access{};
+    access.image = image;
+    access.usage = usage;
+    access.write = false;
+    access.discard = false;
+    _imageAccesses.push_back(access);
+
+    return *this;
+}
+
+RenderGraphPass& RenderGraphPass::Write(const RenderGraphImage image, const ImageUsage usage, const bool discard /* = false*/)
+{
+    if (!image.IsValid())
+        throw std::invalid_argument("Render graph pass '" + _name + "' writes an invalid image");
+
+    ImageAccess access{};
+    access.image = image;
+    access.usage = usage;
+    access.write = true;
+    access.discard = discard;
+    _imageAccesses.push_back(access);
+
+    return *this;
+}
+
+RenderGraphPass& RenderGraphPass::SetExecute(ExecuteFunction&& function)
+{
+    _execute = std::move(function);
+    return *this;
+}
+
+RenderGraphPass& RenderGraphPass::SetSideEffects(const bool hasSideEffects /* = true*/)
+{
+    _hasSideEffects = hasSideEffects;
+    return *this;
+}
+
+void RenderGraphPass::Execute(const VkCommandBuffer cmd) const
+{
+    if (_execute) _execute(cmd);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
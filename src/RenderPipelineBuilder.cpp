@@ -10,6 +10,8 @@
 
 #include "velecs/graphics/RenderPipelineBuilder.hpp"
 
+#include <cstring>
+
 namespace velecs::graphics {
 
 // Public Fields
@@ -24,6 +26,22 @@ RenderPipelineBuilder& RenderPipelineBuilder::SetShaders(const std::vector<VkPip
     return *this;
 }
 
+RenderPipelineBuilder& RenderPipelineBuilder::SetShaderCode(const std::vector<const std::vector<uint32_t>*>& shaderCode)
+{
+    _shaderCode = shaderCode;
+    return *this;
+}
+
+RenderPipelineBuilder& RenderPipelineBuilder::SetPipelineLayoutDescription(
+    const std::vector<VkDescriptorSetLayout>& setLayouts,
+    const std::vector<VkPushConstantRange>& pushConstantRanges
+)
+{
+    _setLayouts = setLayouts;
+    _pushConstantRanges = pushConstantRanges;
+    return *this;
+}
+
 RenderPipelineBuilder& RenderPipelineBuilder::SetVertexInput(const VkPipelineVertexInputStateCreateInfo& vertexInput)
 {
     _vertexInputInfo = vertexInput;
@@ -142,9 +160,104 @@ RenderPipelineBuilder& RenderPipelineBuilder::SetDepthTest(
     return *this;
 }
 
+RenderPipelineBuilder& RenderPipelineBuilder::SetPipelineStateCache(RenderPipelineStateCache* const pipelineStateCache)
+{
+    _pipelineStateCache = pipelineStateCache;
+
+    return *this;
+}
+
+RenderPipelineStateKey RenderPipelineBuilder::GetStateKey() const
+{
+    if (!_setLayouts.has_value() || _shaderCode.size() != _shaderStages.size())
+    {
+        throw std::runtime_error("Pipeline state keys need the shader code and the pipeline layout description");
+    }
+
+    RenderPipelineStateKey key;
+
+    // Set layouts live as long as the layout cache or the engine, unlike pipeline layouts of single programs
+    key.Append(_setLayouts->size());
+    for (const VkDescriptorSetLayout setLayout : *_setLayouts)
+    {
+        key.Append(reinterpret_cast<uint64_t>(setLayout));
+    }
+    key.AppendBytes(_pushConstantRanges.data(), _pushConstantRanges.size() * sizeof(VkPushConstantRange));
+
+    key.Append(_shaderStages.size());
+    for (size_t i{0}; i < _shaderStages.size(); ++i)
+    {
+        const VkPipelineShaderStageCreateInfo& stage = _shaderStages[i];
+        key.Append(stage.flags);
+        key.Append(stage.stage);
+        key.AppendBytes(_shaderCode[i]->data(), _shaderCode[i]->size() * sizeof(uint32_t));
+        key.AppendBytes(stage.pName, std::strlen(stage.pName));
+
+        const VkSpecializationInfo* const specialization = stage.pSpecializationInfo;
+        key.Append(specialization != nullptr ? 1 : 0);
+        if (specialization != nullptr)
+        {
+            key.AppendBytes(specialization->pMapEntries, specialization->mapEntryCount * sizeof(VkSpecializationMapEntry));
+            key.AppendBytes(specialization->pData, specialization->dataSize);
+        }
+    }
+
+    key.AppendBytes(
+        _vertexInputInfo.pVertexBindingDescriptions,
+        _vertexInputInfo.vertexBindingDescriptionCount * sizeof(VkVertexInputBindingDescription)
+    );
+    key.AppendBytes(
+        _vertexInputInfo.pVertexAttributeDescriptions,
+        _vertexInputInfo.vertexAttributeDescriptionCount * sizeof(VkVertexInputAttributeDescription)
+    );
+
+    key.Append(_inputAssembly.topology);
+    key.Append(_inputAssembly.primitiveRestartEnable);
+
+    key.Append(_rasterizer.depthClampEnable);
+    key.Append(_rasterizer.rasterizerDiscardEnable);
+    key.Append(_rasterizer.polygonMode);
+    key.Append(_rasterizer.cullMode);
+    key.Append(_rasterizer.frontFace);
+    key.Append(_rasterizer.depthBiasEnable);
+    key.AppendFloat(_rasterizer.depthBiasConstantFactor);
+    key.AppendFloat(_rasterizer.depthBiasClamp);
+    key.AppendFloat(_rasterizer.depthBiasSlopeFactor);
+    key.AppendFloat(_rasterizer.lineWidth);
+
+    key.Append(_multisampling.rasterizationSamples);
+    key.Append(_multisampling.sampleShadingEnable);
+    key.AppendFloat(_multisampling.minSampleShading);
+    key.Append(_multisampling.alphaToCoverageEnable);
+    key.Append(_multisampling.alphaToOneEnable);
+
+    key.Append(_depthStencil.depthTestEnable);
+    key.Append(_depthStencil.depthWriteEnable);
+    key.Append(_depthStencil.depthCompareOp);
+    key.Append(_depthStencil.depthBoundsTestEnable);
+    key.Append(_depthStencil.stencilTestEnable);
+    key.AppendBytes(&_depthStencil.front, sizeof(VkStencilOpState));
+    key.AppendBytes(&_depthStencil.back, sizeof(VkStencilOpState));
+    key.AppendFloat(_depthStencil.minDepthBounds);
+    key.AppendFloat(_depthStencil.maxDepthBounds);
+
+    key.AppendBytes(&_colorBlendAttachment, sizeof(VkPipelineColorBlendAttachmentState));
+
+    key.Append(_renderInfo.viewMask);
+    key.Append(_renderInfo.colorAttachmentCount);
+    if (_renderInfo.colorAttachmentCount > 0) key.Append(_colorAttachmentFormat);
+    key.Append(_renderInfo.depthAttachmentFormat);
+    key.Append(_renderInfo.stencilAttachmentFormat);
+
+    return key;
+}
+
 void RenderPipelineBuilder::Clear()
 {
     _shaderStages.clear();
+    _shaderCode.clear();
+    _setLayouts.reset();
+    _pushConstantRanges.clear();
 
     _vertexInputInfo = {};
     _vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -174,6 +287,18 @@ void RenderPipelineBuilder::Clear()
 // Protected Methods
 
 VkPipeline RenderPipelineBuilder::CreatePipeline()
+{
+    if (_pipelineStateCache == nullptr) return CompilePipeline();
+
+    // Only the first request of some state compiles, the others get its pipeline
+    return _pipelineStateCache->Acquire(GetStateKey(), [this]() { return CompilePipeline(); });
+}
+
+// Private Fields
+
+// Private Methods
+
+VkPipeline RenderPipelineBuilder::CompilePipeline()
 {
     // Make viewport state from our stored viewport and scissor.
     // At the moment, we wont support multiple viewports or scissors.
@@ -201,12 +326,18 @@ VkPipeline RenderPipelineBuilder::CreatePipeline()
     dynamicState.dynamicStateCount = 2;
     dynamicState.pDynamicStates = dynamicStates;
 
+    VkPipelineCreationFeedback feedback{};
+    VkPipelineCreationFeedbackCreateInfo feedbackInfo{};
+    feedbackInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
+    feedbackInfo.pNext = &_renderInfo;
+    feedbackInfo.pPipelineCreationFeedback = &feedback;
+
     // Pipeline create info
     VkGraphicsPipelineCreateInfo pipelineInfo{};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.pNext = &_renderInfo;
+    pipelineInfo.pNext = &feedbackInfo;
     pipelineInfo.flags = 0;
-    pipelineInfo.stageCount = static_cast<uint32_t>(_shaderStages.size());;
+    pipelineInfo.stageCount = static_cast<uint32_t>(_shaderStages.size());
     pipelineInfo.pStages = _shaderStages.data();
     pipelineInfo.pVertexInputState = &_vertexInputInfo;
     pipelineInfo.pInputAssemblyState = &_inputAssembly;
@@ -224,17 +355,15 @@ VkPipeline RenderPipelineBuilder::CreatePipeline()
     pipelineInfo.basePipelineIndex = 0;
 
     VkPipeline pipeline;
-    VkResult result = vkCreateGraphicsPipelines(_device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline);
+    VkResult result = vkCreateGraphicsPipelines(_device, GetPipelineCacheHandle(), 1, &pipelineInfo, nullptr, &pipeline);
     if (result != VK_SUCCESS)
     {
         throw std::runtime_error("Failed to create graphics pipeline: " + std::to_string(result));
     }
 
+    RecordFeedback(feedback);
+
     return pipeline;
 }
 
-// Private Fields
-
-// Private Methods
-
 } // namespace velecs::graphics
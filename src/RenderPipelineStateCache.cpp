@@ -0,0 +1,124 @@
+/// @file    RenderPipelineStateCache.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 21:58:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/RenderPipelineStateCache.hpp"
+
+#include <exception>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void RenderPipelineStateCache::Init(const VkDevice device)
+{
+    _device = device;
+}
+
+void RenderPipelineStateCache::Cleanup()
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    for (const auto& [pipeline, key] : _pipelineKeys)
+    {
+        vkDestroyPipeline(_device, pipeline, nullptr);
+    }
+    _pipelineKeys.clear();
+    _entries.clear();
+}
+
+VkPipeline RenderPipelineStateCache::Acquire(const RenderPipelineStateKey& key, const std::function<VkPipeline()>& create)
+{
+    std::unique_lock<std::mutex> lock{_mutex};
+
+    auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        ++it->second.refCount;
+        ++_reuseCount;
+        std::shared_future<VkPipeline> pipeline = it->second.pipeline;
+
+        // Waits outside of the lock when the pipeline still compiles on another thread
+        lock.unlock();
+        return pipeline.get();
+    }
+
+    std::promise<VkPipeline> promise;
+    auto entryIt = _entries.emplace(key, Entry{promise.get_future().share(), 1}).first;
+    const RenderPipelineStateKey* const storedKey = &entryIt->first;
+
+    // Compiled without the lock, so pipelines of other states compile alongside
+    lock.unlock();
+
+    VkPipeline pipeline{VK_NULL_HANDLE};
+    try
+    {
+        pipeline = create();
+    }
+    catch (...)
+    {
+        promise.set_exception(std::current_exception());
+
+        // Waiting requests got the exception, they hold no reference
+        lock.lock();
+        _entries.erase(*storedKey);
+        throw;
+    }
+
+    lock.lock();
+    _pipelineKeys.emplace(pipeline, storedKey);
+    lock.unlock();
+
+    promise.set_value(pipeline);
+
+    return pipeline;
+}
+
+void RenderPipelineStateCache::Release(const VkPipeline pipeline)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Unknown after Cleanup()
+    auto keyIt = _pipelineKeys.find(pipeline);
+    if (keyIt == _pipelineKeys.end()) return;
+
+    auto entryIt = _entries.find(*keyIt->second);
+    if (--entryIt->second.refCount == 0)
+    {
+        vkDestroyPipeline(_device, pipeline, nullptr);
+        _pipelineKeys.erase(keyIt);
+        _entries.erase(entryIt);
+    }
+}
+
+size_t RenderPipelineStateCache::GetPipelineCount() const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _pipelineKeys.size();
+}
+
+uint64_t RenderPipelineStateCache::GetReuseCount() const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _reuseCount;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
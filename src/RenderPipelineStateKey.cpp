@@ -0,0 +1,59 @@
+/// @file    RenderPipelineStateKey.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 21:58:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/RenderPipelineStateKey.hpp"
+
+#include "velecs/graphics/Shader/SpirVHash.hpp"
+
+#include <cstring>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void RenderPipelineStateKey::Append(const uint64_t word)
+{
+    words.push_back(word);
+}
+
+void RenderPipelineStateKey::AppendFloat(const float value)
+{
+    uint32_t bits{0};
+    std::memcpy(&bits, &value, sizeof(bits));
+    words.push_back(bits);
+}
+
+void RenderPipelineStateKey::AppendBytes(const void* const data, const size_t size)
+{
+    words.push_back(size);
+
+    const size_t first = words.size();
+    words.resize(first + (size + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+    if (size > 0) std::memcpy(&words[first], data, size);
+}
+
+size_t RenderPipelineStateKeyHash::operator()(const RenderPipelineStateKey& key) const
+{
+    return static_cast<size_t>(Fnv1a(key.words.data(), key.words.size() * sizeof(uint64_t)));
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
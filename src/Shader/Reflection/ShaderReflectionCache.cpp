@@ -0,0 +1,302 @@
+/// @file    ShaderReflectionCache.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 20:14:53
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Shader/Reflection/ShaderReflectionCache.hpp"
+
+#include "velecs/graphics/Shader/SpirVHash.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+namespace velecs::graphics {
+
+namespace {  // Anonymous namespace for private implementation
+
+// Serialized size of an element whose strings and child arrays are empty
+const size_t MEMBER_MIN_SIZE = 6 * sizeof(uint32_t);
+const size_t RESOURCE_MIN_SIZE = 9 * sizeof(uint32_t);
+
+void WriteU32(std::ostream& os, const uint32_t value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteU64(std::ostream& os, const uint64_t value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteString(std::ostream& os, const std::string& value)
+{
+    WriteU32(os, static_cast<uint32_t>(value.size()));
+    os.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+void WriteMembers(std::ostream& os, const std::vector<ShaderMember>& members)
+{
+    WriteU32(os, static_cast<uint32_t>(members.size()));
+    for (const ShaderMember& member : members)
+    {
+        WriteString(os, member.name);
+        WriteU32(os, member.offset);
+        WriteU32(os, member.size);
+        WriteU32(os, member.arraySize);
+        WriteU32(os, static_cast<uint32_t>(member.type));
+        WriteMembers(os, member.members);
+    }
+}
+
+void WriteResources(std::ostream& os, const std::vector<ShaderResource>& resources)
+{
+    WriteU32(os, static_cast<uint32_t>(resources.size()));
+    for (const ShaderResource& resource : resources)
+    {
+        WriteU32(os, static_cast<uint32_t>(resource.type));
+        WriteU32(os, resource.stages);
+        WriteString(os, resource.name);
+        WriteU32(os, resource.offset);
+        WriteU32(os, resource.size);
+        WriteU32(os, resource.set);
+        WriteU32(os, resource.binding);
+        WriteU32(os, resource.arraySize);
+        WriteMembers(os, resource.members);
+    }
+}
+
+// Readers leave the stream failed on truncated input, the caller checks it once at the end
+
+bool ReadU32(std::istream& is, uint32_t& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+bool ReadU64(std::istream& is, uint64_t& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+// Counts come from the file, so one that could not fit in the rest of it is rejected before allocating
+bool ReadCount(std::istream& is, uint32_t& count, const size_t minElementSize)
+{
+    if (!ReadU32(is, count)) return false;
+
+    const std::streampos position = is.tellg();
+    is.seekg(0, std::ios::end);
+    const std::streamoff remaining = is.tellg() - position;
+    is.seekg(position);
+
+    if (!is || static_cast<uint64_t>(count) * minElementSize > static_cast<uint64_t>(remaining))
+    {
+        is.setstate(std::ios::failbit);
+        return false;
+    }
+
+    return true;
+}
+
+bool ReadString(std::istream& is, std::string& value)
+{
+    uint32_t size{0};
+    if (!ReadCount(is, size, sizeof(char))) return false;
+
+    value.resize(size);
+    return static_cast<bool>(is.read(value.data(), static_cast<std::streamsize>(size)));
+}
+
+bool ReadMembers(std::istream& is, std::vector<ShaderMember>& members)
+{
+    uint32_t count{0};
+    if (!ReadCount(is, count, MEMBER_MIN_SIZE)) return false;
+
+    members.resize(count);
+    for (ShaderMember& member : members)
+    {
+        uint32_t type{0};
+        if (!ReadString(is, member.name)
+            || !ReadU32(is, member.offset)
+            || !ReadU32(is, member.size)
+            || !ReadU32(is, member.arraySize)
+            || !ReadU32(is, type)
+            || !ReadMembers(is, member.members)) return false;
+
+        member.type = static_cast<ShaderMemberType>(type);
+    }
+
+    return true;
+}
+
+bool ReadResources(std::istream& is, std::vector<ShaderResource>& resources)
+{
+    uint32_t count{0};
+    if (!ReadCount(is, count, RESOURCE_MIN_SIZE)) return false;
+
+    resources.resize(count);
+    for (ShaderResource& resource : resources)
+    {
+        uint32_t type{0};
+        uint32_t stages{0};
+        if (!ReadU32(is, type)
+            || !ReadU32(is, stages)
+            || !ReadString(is, resource.name)
+            || !ReadU32(is, resource.offset)
+            || !ReadU32(is, resource.size)
+            || !ReadU32(is, resource.set)
+            || !ReadU32(is, resource.binding)
+            || !ReadU32(is, resource.arraySize)
+            || !ReadMembers(is, resource.members)) return false;
+
+        resource.type = static_cast<ShaderResourceType>(type);
+        resource.stages = stages;
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+// Public Fields
+
+const uint32_t ShaderReflectionCache::FILE_MAGIC = 0x4C465256; // "VRFL"
+const uint32_t ShaderReflectionCache::FILE_VERSION = 3;
+
+// Constructors and Destructors
+
+// Public Methods
+
+uint64_t ShaderReflectionCache::MakeKey(
+    const std::vector<uint32_t>& spirvCode,
+    const std::string& entryPoint,
+    const VkShaderStageFlagBits stage
+)
+{
+    // The stage is part of the key, it is written into the stages of every resource
+    return Fnv1a(&stage, sizeof(stage), HashSpirV(spirvCode, entryPoint));
+}
+
+bool ShaderReflectionCache::Find(const uint64_t key, ShaderReflectionData& data) const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto it = _entries.find(key);
+    if (it == _entries.end()) return false;
+
+    data = it->second;
+    return true;
+}
+
+void ShaderReflectionCache::Insert(const uint64_t key, const ShaderReflectionData& data)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    _entries.insert_or_assign(key, data);
+    _dirty = true;
+}
+
+bool ShaderReflectionCache::Load(const std::filesystem::path& filePath)
+{
+    std::ifstream file{filePath, std::ios::binary};
+    if (!file) return false;
+
+    uint32_t magic{0};
+    uint32_t version{0};
+    uint32_t count{0};
+    if (!ReadU32(file, magic) || !ReadU32(file, version) || !ReadU32(file, count)) return false;
+    if (magic != FILE_MAGIC || version != FILE_VERSION)
+    {
+        std::cout << "Discarding shader reflection cache of another version: " << filePath.string() << std::endl;
+        return false;
+    }
+
+    // Read completely before touching the entries, so a truncated file adds nothing
+    std::unordered_map<uint64_t, ShaderReflectionData> entries;
+    for (uint32_t i{0}; i < count; ++i)
+    {
+        uint64_t key{0};
+        ShaderReflectionData data;
+        if (!ReadU64(file, key)
+            || !ReadResources(file, data.uniformBuffers)
+            || !ReadResources(file, data.storageImages)
+            || !ReadResources(file, data.sampledImages)
+            || !ReadResources(file, data.pushConstants))
+        {
+            std::cout << "Discarding truncated or corrupted shader reflection cache: " << filePath.string() << std::endl;
+            return false;
+        }
+
+        entries.emplace(key, std::move(data));
+    }
+
+    // Only adds the shaders not reflected yet, equal keys hold equal data anyway
+    std::lock_guard<std::mutex> lock{_mutex};
+    _entries.merge(entries);
+
+    return true;
+}
+
+bool ShaderReflectionCache::Save(const std::filesystem::path& filePath)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (!_dirty) return true;
+
+    std::error_code error;
+    std::filesystem::create_directories(filePath.parent_path(), error);
+
+    std::filesystem::path tempPath = filePath;
+    tempPath += ".tmp";
+    {
+        std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+
+        WriteU32(file, FILE_MAGIC);
+        WriteU32(file, FILE_VERSION);
+        WriteU32(file, static_cast<uint32_t>(_entries.size()));
+        for (const auto& [key, data] : _entries)
+        {
+            WriteU64(file, key);
+            WriteResources(file, data.uniformBuffers);
+            WriteResources(file, data.storageImages);
+            WriteResources(file, data.sampledImages);
+            WriteResources(file, data.pushConstants);
+        }
+
+        if (!file)
+        {
+            std::cerr << "Failed to write shader reflection cache: " << tempPath.string() << std::endl;
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, filePath, error);
+    if (error)
+    {
+        std::cerr << "Failed to replace shader reflection cache: " << error.message() << std::endl;
+        return false;
+    }
+
+    _dirty = false;
+
+    return true;
+}
+
+size_t ShaderReflectionCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _entries.size();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
@@ -10,6 +10,8 @@
 
 #include "velecs/graphics/Shader/Reflection/ShaderReflectionData.hpp"
 
+#include <unordered_map>
+
 namespace velecs::graphics {
 
 // Public Fields
@@ -23,12 +25,24 @@ ShaderReflectionData ShaderReflectionData::Merge(const ShaderReflectionData& oth
     ShaderReflectionData merged;
     
     merged.uniformBuffers = MergeResourceVector(uniformBuffers, other.uniformBuffers);
+    merged.storageImages = MergeResourceVector(storageImages, other.storageImages);
     merged.sampledImages = MergeResourceVector(sampledImages, other.sampledImages);
     merged.pushConstants = MergeResourceVector(pushConstants, other.pushConstants);
     
     return merged;
 }
 
+std::vector<std::vector<VkDescriptorSetLayoutBinding>> ShaderReflectionData::GetSetLayoutBindings() const
+{
+    std::vector<std::vector<VkDescriptorSetLayoutBinding>> sets;
+
+    AddSetLayoutBindings(sets, uniformBuffers, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    AddSetLayoutBindings(sets, storageImages, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
+    AddSetLayoutBindings(sets, sampledImages, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+
+    return sets;
+}
+
 std::ostream& operator<<(std::ostream& os, const ShaderReflectionData& data) {
     os << "ShaderReflectionData {\n";
     
@@ -93,29 +107,64 @@ std::vector<ShaderResource> ShaderReflectionData::MergeResourceVector(
 )
 {
     std::vector<ShaderResource> merged = a; // Start with all resources from 'a'
-    
+    merged.reserve(a.size() + b.size());
+
+    // Index of every merged resource by key, equal keys are still compared in case of a collision
+    std::unordered_multimap<uint64_t, size_t> indices;
+    indices.reserve(merged.size() + b.size());
+    for (size_t i{0}; i < merged.size(); ++i)
+    {
+        indices.emplace(merged[i].GetKeyHash(), i);
+    }
+
     // Process each resource from 'b'
     for (const auto& resourceB : b)
     {
-        // Try to find matching resource in our merged list
-        auto it = std::find_if(merged.begin(), merged.end(), 
-            [&resourceB](const ShaderResource& existing) {
-                return existing == resourceB;
-            });
-        
-        if (it != merged.end())
+        const uint64_t key = resourceB.GetKeyHash();
+
+        bool found = false;
+        auto [begin, end] = indices.equal_range(key);
+        for (auto it = begin; it != end; ++it)
         {
-            // Found duplicate - merge stages (now we can modify 'merged')
-            it->stages |= resourceB.stages;
+            ShaderResource& existing = merged[it->second];
+            if (existing == resourceB)
+            {
+                // Found duplicate - merge stages
+                existing.stages |= resourceB.stages;
+                found = true;
+                break;
+            }
         }
-        else
+
+        if (!found)
         {
             // New resource - add it
+            indices.emplace(key, merged.size());
             merged.push_back(resourceB);
         }
     }
-    
+
     return merged;
 }
 
+void ShaderReflectionData::AddSetLayoutBindings(
+    std::vector<std::vector<VkDescriptorSetLayoutBinding>>& sets,
+    const std::vector<ShaderResource>& resources,
+    const VkDescriptorType descriptorType
+)
+{
+    for (const ShaderResource& resource : resources)
+    {
+        if (sets.size() <= resource.set) sets.resize(resource.set + 1);
+
+        // Merge() already folded the stages of a binding used by several shaders
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding = resource.binding;
+        binding.descriptorType = descriptorType;
+        binding.descriptorCount = resource.arraySize;
+        binding.stageFlags = resource.stages;
+        sets[resource.set].push_back(binding);
+    }
+}
+
 } // namespace velecs::graphics
@@ -12,6 +12,8 @@
 
 #include "velecs/graphics/Shader/Shaders/Shader.hpp"
 #include "velecs/graphics/Shader/Reflection/ShaderResource.hpp"
+#include "velecs/graphics/Shader/Reflection/ShaderReflectionCache.hpp"
+#include "velecs/graphics/Shader/Reflection/SpirVParser.hpp"
 
 #include <spirv_cross/spirv_cross.hpp>
 
@@ -27,21 +29,24 @@ ShaderMemberType MapSpirVTypeToShaderMemberType(const spirv_cross::SPIRType& spi
     switch (spirvType.basetype)
     {
     case spirv_cross::SPIRType::Float:
-        switch (spirvType.vecsize)
-        {
-            case 1: return ShaderMemberType::Float;
-            case 2: return ShaderMemberType::Vec2;
-            case 3: return ShaderMemberType::Vec3;
-            case 4: return ShaderMemberType::Vec4;
-        }
+        // Checked first, vecsize holds the rows of a matrix
         if (spirvType.columns > 1)
         {
+            if (spirvType.vecsize != spirvType.columns) break;
             switch (spirvType.columns)
             {
                 // case 2: return ShaderMemberType::Mat2;
                 // case 3: return ShaderMemberType::Mat3;
                 case 4: return ShaderMemberType::Mat4;
             }
+            break;
+        }
+        switch (spirvType.vecsize)
+        {
+            case 1: return ShaderMemberType::Float;
+            case 2: return ShaderMemberType::Vec2;
+            case 3: return ShaderMemberType::Vec3;
+            case 4: return ShaderMemberType::Vec4;
         }
         break;
         
@@ -70,6 +75,17 @@ ShaderMemberType MapSpirVTypeToShaderMemberType(const spirv_cross::SPIRType& spi
     return ShaderMemberType::Unknown;
 }
 
+uint32_t GetDescriptorCount(const spirv_cross::SPIRType& type)
+{
+    uint32_t count{1};
+    for (size_t i{0}; i < type.array.size(); ++i)
+    {
+        // Runtime arrays have a literal length of 0, specialized lengths hold the id of their constant
+        count *= type.array_size_literal[i] ? type.array[i] : 0;
+    }
+    return count;
+}
+
 std::vector<ShaderMember> ExtractStructMembers(const spirv_cross::Compiler& compiler, const spirv_cross::SPIRType& structType)
 {
     std::vector<ShaderMember> members;
@@ -96,7 +112,7 @@ std::vector<ShaderMember> ExtractStructMembers(const spirv_cross::Compiler& comp
     return members;
 }
 
-ShaderReflectionData ParseSpirV(const std::vector<uint32_t>& spirvCode, VkShaderStageFlagBits stage)
+ShaderReflectionData ParseSpirVCross(const std::vector<uint32_t>& spirvCode, VkShaderStageFlagBits stage)
 {
     ShaderReflectionData data;
     spirv_cross::Compiler compiler(spirvCode);
@@ -111,6 +127,7 @@ ShaderReflectionData ParseSpirV(const std::vector<uint32_t>& spirvCode, VkShader
         resource.name = ubo.name;
         resource.set = compiler.get_decoration(ubo.id, spv::DecorationDescriptorSet);
         resource.binding = compiler.get_decoration(ubo.id, spv::DecorationBinding);
+        resource.arraySize = GetDescriptorCount(compiler.get_type(ubo.type_id));
         const auto& type = compiler.get_type(ubo.base_type_id);
         resource.size = static_cast<uint32_t>(compiler.get_declared_struct_size(type));
         resource.members = ExtractStructMembers(compiler, type);
@@ -127,6 +144,7 @@ ShaderReflectionData ParseSpirV(const std::vector<uint32_t>& spirvCode, VkShader
         resource.name = storageImage.name;
         resource.set = compiler.get_decoration(storageImage.id, spv::DecorationDescriptorSet);
         resource.binding = compiler.get_decoration(storageImage.id, spv::DecorationBinding);
+        resource.arraySize = GetDescriptorCount(compiler.get_type(storageImage.type_id));
         resource.size = 0; // Storage images don't have a traditional size
         
         data.storageImages.push_back(resource); // You'll need to add this vector to ShaderReflectionData
@@ -142,6 +160,7 @@ ShaderReflectionData ParseSpirV(const std::vector<uint32_t>& spirvCode, VkShader
         resource.name = sampler.name;
         resource.set = compiler.get_decoration(sampler.id, spv::DecorationDescriptorSet);
         resource.binding = compiler.get_decoration(sampler.id, spv::DecorationBinding);
+        resource.arraySize = GetDescriptorCount(compiler.get_type(sampler.type_id));
         resource.size = 0; // Samplers don't have a size
         
         data.sampledImages.push_back(resource);
@@ -164,13 +183,43 @@ ShaderReflectionData ParseSpirV(const std::vector<uint32_t>& spirvCode, VkShader
     return data;
 }
 
+ShaderReflectionCache& GetReflectionCache()
+{
+    static ShaderReflectionCache cache;
+    return cache;
+}
+
 } // anonymous namespace
 
 // Public interface implementation
 ShaderReflectionData Reflect(const Shader& shader)
 {
     const auto& spirvCode = shader.GetSpirVCode();
-    return ParseSpirV(spirvCode, shader.GetStage());
+
+    ShaderReflectionCache& cache = GetReflectionCache();
+    const uint64_t key = ShaderReflectionCache::MakeKey(spirvCode, shader.GetEntryPoint(), shader.GetStage());
+
+    ShaderReflectionData data;
+    if (cache.Find(key, data)) return data;
+
+    data = ParseSpirV(spirvCode, shader.GetStage());
+    cache.Insert(key, data);
+    return data;
+}
+
+ShaderReflectionData ReflectWithSpirVCross(const Shader& shader)
+{
+    return ParseSpirVCross(shader.GetSpirVCode(), shader.GetStage());
+}
+
+bool LoadReflectionCache(const std::filesystem::path& filePath)
+{
+    return GetReflectionCache().Load(filePath);
+}
+
+bool SaveReflectionCache(const std::filesystem::path& filePath)
+{
+    return GetReflectionCache().Save(filePath);
 }
 
 } // namespace velecs::graphics
\ No newline at end of file
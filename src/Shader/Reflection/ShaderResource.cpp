@@ -10,6 +10,8 @@
 
 #include "velecs/graphics/Shader/Reflection/ShaderResource.hpp"
 
+#include "velecs/graphics/Shader/SpirVHash.hpp"
+
 namespace velecs::graphics {
 
 // Public Fields
@@ -37,6 +39,20 @@ bool ShaderResource::operator!=(const ShaderResource& other) const
     return !(*this == other);
 }
 
+uint64_t ShaderResource::GetKeyHash() const
+{
+    uint64_t hash = Fnv1a(&type, sizeof(type));
+
+    if (type == ShaderResourceType::PushConstant)
+    {
+        hash = Fnv1a(name.data(), name.size(), hash);
+        return Fnv1a(&size, sizeof(size), hash);
+    }
+
+    hash = Fnv1a(&set, sizeof(set), hash);
+    return Fnv1a(&binding, sizeof(binding), hash);
+}
+
 std::ostream& operator<<(std::ostream& os, const ShaderResource& resource)
 {
     os << "ShaderResource {\n";
@@ -81,6 +97,7 @@ std::ostream& operator<<(std::ostream& os, const ShaderResource& resource)
     os << "  size: " << resource.size << "\n";
     os << "  set: " << resource.set << "\n";
     os << "  binding: " << resource.binding << "\n";
+    os << "  arraySize: " << resource.arraySize << "\n";
 
     if (resource.members.size() > 0)
     {
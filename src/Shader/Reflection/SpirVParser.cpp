@@ -0,0 +1,540 @@
+/// @file    SpirVParser.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 20:48:31
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Shader/Reflection/SpirVParser.hpp"
+
+#include <spirv_cross/spirv.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace velecs::graphics {
+
+namespace {  // Anonymous namespace for private implementation
+
+const uint32_t HEADER_WORD_COUNT = 5;
+
+/// @brief Largest id bound accepted, rejects corrupt headers before the id table is allocated.
+const uint32_t MAX_ID_BOUND = 0x400000;
+
+enum class MemberField : uint32_t {
+    Name,
+    Offset,
+    MatrixStride,
+    RowMajor,
+};
+
+/// @brief A name or decoration of one struct member.
+struct MemberRecord {
+    uint32_t structId{0};
+    uint32_t member{0};
+    MemberField field{MemberField::Name};
+    uint32_t value{0}; /// @brief Word position of the OpMemberName for names, the decoration literal otherwise.
+
+    bool operator<(const MemberRecord& other) const
+    {
+        return std::tie(structId, member, field) < std::tie(other.structId, other.member, other.field);
+    }
+};
+
+/// @brief What reflection needs to know about one id.
+struct IdRecord {
+    uint32_t declaration{0}; /// @brief Word position of the instruction declaring the id, 0 if undeclared.
+    uint32_t name{0};        /// @brief Word position of its OpName, 0 if unnamed.
+    uint32_t set{0};
+    uint32_t binding{0};
+    uint32_t arrayStride{0};
+    bool block{false};       /// @brief Decorated Block, tells uniform buffers apart from storage buffers.
+};
+
+uint32_t Opcode(const uint32_t* words)
+{
+    return words[0] & spv::OpCodeMask;
+}
+
+uint32_t WordCount(const uint32_t* words)
+{
+    return words[0] >> spv::WordCountShift;
+}
+
+class WordStreamParser {
+public:
+    explicit WordStreamParser(const std::vector<uint32_t>& spirvCode) : _code(spirvCode) {}
+
+    ShaderReflectionData Parse(const VkShaderStageFlagBits stage)
+    {
+        Scan();
+
+        ShaderReflectionData data;
+        for (const uint32_t position : _variables)
+        {
+            const uint32_t* variable = &_code[position];
+            const uint32_t variableId = variable[2];
+            const uint32_t storageClass = variable[3];
+
+            // Inputs, outputs and workgroup variables are never resources, and may use types reflection does not resolve
+            if (storageClass != spv::StorageClassUniform
+                && storageClass != spv::StorageClassUniformConstant
+                && storageClass != spv::StorageClassPushConstant) continue;
+
+            const uint32_t* pointer = Declaration(variable[1]);
+            if (Opcode(pointer) != spv::OpTypePointer) continue;
+
+            // Arrays of resources reflect as their element, with the array as the descriptor count
+            const uint32_t typeId = StripArrays(pointer[3]);
+            const uint32_t* type = Declaration(typeId);
+            const IdRecord& record = Id(variableId);
+
+            ShaderResource resource;
+            resource.stages = stage;
+            resource.name = Name(variableId);
+            resource.arraySize = DescriptorCount(pointer[3]);
+
+            if (storageClass == spv::StorageClassUniform)
+            {
+                if (Opcode(type) != spv::OpTypeStruct || !Id(typeId).block) continue;
+
+                // Named after the block like SPIRV-Cross does, the instance name is optional in GLSL
+                resource.type = ShaderResourceType::UniformBuffer;
+                const std::string blockName = Name(typeId);
+                if (!blockName.empty()) resource.name = blockName;
+                resource.set = record.set;
+                resource.binding = record.binding;
+                resource.size = StructSize(typeId);
+                resource.members = ExtractStructMembers(typeId);
+
+                data.uniformBuffers.push_back(std::move(resource));
+            }
+            else if (storageClass == spv::StorageClassUniformConstant)
+            {
+                if (Opcode(type) == spv::OpTypeImage && type[7] == 2)
+                {
+                    resource.type = ShaderResourceType::StorageImage;
+                    resource.set = record.set;
+                    resource.binding = record.binding;
+
+                    data.storageImages.push_back(std::move(resource));
+                }
+                else if (Opcode(type) == spv::OpTypeSampledImage)
+                {
+                    resource.type = ShaderResourceType::SampledImage;
+                    resource.set = record.set;
+                    resource.binding = record.binding;
+
+                    data.sampledImages.push_back(std::move(resource));
+                }
+            }
+            else if (storageClass == spv::StorageClassPushConstant)
+            {
+                if (Opcode(type) != spv::OpTypeStruct) continue;
+
+                resource.type = ShaderResourceType::PushConstant;
+                resource.size = StructSize(typeId);
+                resource.members = ExtractStructMembers(typeId);
+
+                data.pushConstants.push_back(std::move(resource));
+            }
+        }
+
+        return data;
+    }
+
+private:
+    const std::vector<uint32_t>& _code;
+    std::vector<IdRecord> _ids;
+    std::vector<MemberRecord> _members;    /// @brief Sorted once scanning is done.
+    std::vector<uint32_t> _variables;      /// @brief Word positions of the global OpVariables, in declaration order.
+
+    /// @brief Records every instruction reflection reads, up to the first function.
+    void Scan()
+    {
+        if (_code.size() < HEADER_WORD_COUNT || _code[0] != spv::MagicNumber)
+        {
+            throw std::runtime_error("Invalid SPIR-V: missing header");
+        }
+
+        const uint32_t bound = _code[3];
+        if (bound > MAX_ID_BOUND)
+        {
+            std::ostringstream oss;
+            oss << "Invalid SPIR-V: id bound " << bound << " too large";
+            throw std::runtime_error(oss.str());
+        }
+        _ids.resize(bound);
+
+        size_t position = HEADER_WORD_COUNT;
+        while (position < _code.size())
+        {
+            const uint32_t* words = &_code[position];
+            const uint32_t wordCount = WordCount(words);
+            if (wordCount == 0 || position + wordCount > _code.size())
+            {
+                std::ostringstream oss;
+                oss << "Invalid SPIR-V: truncated instruction at word " << position;
+                throw std::runtime_error(oss.str());
+            }
+
+            const uint32_t pos = static_cast<uint32_t>(position);
+            switch (Opcode(words))
+            {
+            case spv::OpName:
+                if (wordCount >= 3) Id(words[1]).name = pos;
+                break;
+
+            case spv::OpMemberName:
+                if (wordCount >= 4) _members.push_back({words[1], words[2], MemberField::Name, pos});
+                break;
+
+            case spv::OpDecorate:
+            {
+                if (wordCount < 3) break;
+
+                IdRecord& record = Id(words[1]);
+                const uint32_t literal = wordCount > 3 ? words[3] : 0;
+                switch (words[2])
+                {
+                case spv::DecorationDescriptorSet: record.set = literal;         break;
+                case spv::DecorationBinding:       record.binding = literal;     break;
+                case spv::DecorationArrayStride:   record.arrayStride = literal; break;
+                case spv::DecorationBlock:         record.block = true;          break;
+                }
+                break;
+            }
+
+            case spv::OpMemberDecorate:
+            {
+                if (wordCount < 4) break;
+
+                const uint32_t literal = wordCount > 4 ? words[4] : 0;
+                switch (words[3])
+                {
+                case spv::DecorationOffset:       _members.push_back({words[1], words[2], MemberField::Offset, literal});       break;
+                case spv::DecorationMatrixStride: _members.push_back({words[1], words[2], MemberField::MatrixStride, literal}); break;
+                case spv::DecorationRowMajor:     _members.push_back({words[1], words[2], MemberField::RowMajor, 1});           break;
+                }
+                break;
+            }
+
+            // Every type a global variable or constant may reference, resolving a pointee never meets an undeclared id
+            case spv::OpTypeVoid:
+            case spv::OpTypeBool:
+            case spv::OpTypeInt:
+            case spv::OpTypeFloat:
+            case spv::OpTypeVector:
+            case spv::OpTypeMatrix:
+            case spv::OpTypeImage:
+            case spv::OpTypeSampler:
+            case spv::OpTypeSampledImage:
+            case spv::OpTypeArray:
+            case spv::OpTypeRuntimeArray:
+            case spv::OpTypeStruct:
+            case spv::OpTypeOpaque:
+            case spv::OpTypePointer:
+            case spv::OpTypeFunction:
+            case spv::OpTypeAccelerationStructureKHR:
+            case spv::OpTypeRayQueryKHR:
+                if (wordCount >= 2) Id(words[1]).declaration = pos;
+                break;
+
+            case spv::OpConstantTrue:
+            case spv::OpConstantFalse:
+            case spv::OpConstant:
+            case spv::OpConstantComposite:
+            case spv::OpConstantSampler:
+            case spv::OpConstantNull:
+            case spv::OpSpecConstantTrue:
+            case spv::OpSpecConstantFalse:
+            case spv::OpSpecConstant:
+            case spv::OpSpecConstantComposite:
+            case spv::OpSpecConstantOp:
+            case spv::OpUndef:
+                if (wordCount >= 3) Id(words[2]).declaration = pos;
+                break;
+
+            case spv::OpVariable:
+                if (wordCount >= 4)
+                {
+                    Id(words[2]).declaration = pos;
+                    _variables.push_back(pos);
+                }
+                break;
+
+            case spv::OpFunction:
+                // Types, constants and global variables all precede the functions
+                position = _code.size();
+                continue;
+            }
+
+            position += wordCount;
+        }
+
+        std::sort(_members.begin(), _members.end());
+    }
+
+    const IdRecord& Id(const uint32_t id) const
+    {
+        if (id >= _ids.size())
+        {
+            std::ostringstream oss;
+            oss << "Invalid SPIR-V: id " << id << " out of bounds";
+            throw std::runtime_error(oss.str());
+        }
+        return _ids[id];
+    }
+
+    IdRecord& Id(const uint32_t id)
+    {
+        return const_cast<IdRecord&>(std::as_const(*this).Id(id));
+    }
+
+    const uint32_t* Declaration(const uint32_t id) const
+    {
+        const uint32_t position = Id(id).declaration;
+        if (position == 0)
+        {
+            std::ostringstream oss;
+            oss << "Invalid SPIR-V: id " << id << " is not declared";
+            throw std::runtime_error(oss.str());
+        }
+        return &_code[position];
+    }
+
+    /// @brief Reads the string starting at some word of an instruction.
+    std::string ReadString(const uint32_t position, const uint32_t firstWord) const
+    {
+        const uint32_t wordCount = WordCount(&_code[position]);
+        if (firstWord >= wordCount) return {};
+
+        const char* begin = reinterpret_cast<const char*>(&_code[position + firstWord]);
+        const char* end = begin + (wordCount - firstWord) * sizeof(uint32_t);
+        return std::string(begin, std::find(begin, end, '\0'));
+    }
+
+    std::string Name(const uint32_t id) const
+    {
+        const uint32_t position = Id(id).name;
+        return position == 0 ? std::string{} : ReadString(position, 2);
+    }
+
+    bool FindMember(const uint32_t structId, const uint32_t member, const MemberField field, uint32_t& value) const
+    {
+        const MemberRecord key{structId, member, field, 0};
+        auto it = std::lower_bound(_members.begin(), _members.end(), key);
+        if (it == _members.end() || key < *it) return false;
+
+        value = it->value;
+        return true;
+    }
+
+    std::string MemberName(const uint32_t structId, const uint32_t member) const
+    {
+        uint32_t position{0};
+        return FindMember(structId, member, MemberField::Name, position) ? ReadString(position, 3) : std::string{};
+    }
+
+    uint32_t MemberOffset(const uint32_t structId, const uint32_t member) const
+    {
+        uint32_t offset{0};
+        FindMember(structId, member, MemberField::Offset, offset);
+        return offset;
+    }
+
+    uint32_t StripArrays(uint32_t typeId) const
+    {
+        const uint32_t* type = Declaration(typeId);
+        while (Opcode(type) == spv::OpTypeArray || Opcode(type) == spv::OpTypeRuntimeArray)
+        {
+            typeId = type[2];
+            type = Declaration(typeId);
+        }
+        return typeId;
+    }
+
+    /// @brief Gets the element count of an array type.
+    /// @details 0 for runtime arrays and for lengths only known once specialized, such as an OpSpecConstantOp.
+    uint32_t ArrayLength(const uint32_t* arrayType) const
+    {
+        if (Opcode(arrayType) != spv::OpTypeArray) return 0;
+
+        // Spec constants reflect as their default value
+        const uint32_t* length = Declaration(arrayType[3]);
+        if (Opcode(length) != spv::OpConstant && Opcode(length) != spv::OpSpecConstant) return 0;
+        if (WordCount(length) < 4) return 0;
+        return length[3];
+    }
+
+    /// @brief Gets the length of the innermost dimension of an array type, 0 if not an array.
+    uint32_t InnermostArrayLength(const uint32_t typeId) const
+    {
+        uint32_t length{0};
+        const uint32_t* type = Declaration(typeId);
+        while (Opcode(type) == spv::OpTypeArray || Opcode(type) == spv::OpTypeRuntimeArray)
+        {
+            length = ArrayLength(type);
+            type = Declaration(type[2]);
+        }
+        return length;
+    }
+
+    /// @brief Gets the number of descriptors of a resource type, the product of its array lengths.
+    /// @details 0 for runtime arrays and lengths set by specialization, like SPIRV-Cross.
+    uint32_t DescriptorCount(const uint32_t typeId) const
+    {
+        uint32_t count{1};
+        const uint32_t* type = Declaration(typeId);
+        while (Opcode(type) == spv::OpTypeArray || Opcode(type) == spv::OpTypeRuntimeArray)
+        {
+            const uint32_t* length = Opcode(type) == spv::OpTypeArray ? Declaration(type[3]) : nullptr;
+            const bool literal = length != nullptr && Opcode(length) == spv::OpConstant && WordCount(length) >= 4;
+            count *= literal ? length[3] : 0;
+
+            type = Declaration(type[2]);
+        }
+        return count;
+    }
+
+    bool IsFloat32(const uint32_t typeId) const
+    {
+        const uint32_t* type = Declaration(typeId);
+        return Opcode(type) == spv::OpTypeFloat && type[2] == 32;
+    }
+
+    /// @brief Gets the size of a scalar or vector type in bytes, 0 for other types.
+    uint32_t ScalarOrVectorSize(const uint32_t typeId) const
+    {
+        const uint32_t* type = Declaration(typeId);
+        switch (Opcode(type))
+        {
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+            return type[2] / 8;
+        case spv::OpTypeVector:
+            return type[3] * ScalarOrVectorSize(type[2]);
+        }
+        return 0;
+    }
+
+    /// @brief Gets the declared size of a struct, up to the end of its last member.
+    uint32_t StructSize(const uint32_t structId) const
+    {
+        const uint32_t memberCount = WordCount(Declaration(structId)) - 2;
+        if (memberCount == 0) return 0;
+
+        const uint32_t last = memberCount - 1;
+        return MemberOffset(structId, last) + MemberSize(structId, last);
+    }
+
+    uint32_t MemberSize(const uint32_t structId, const uint32_t member) const
+    {
+        const uint32_t typeId = Declaration(structId)[2 + member];
+        const uint32_t* type = Declaration(typeId);
+        switch (Opcode(type))
+        {
+        case spv::OpTypeArray:
+            return Id(typeId).arrayStride * ArrayLength(type);
+        case spv::OpTypeRuntimeArray:
+            return 0;
+        case spv::OpTypeStruct:
+            return StructSize(typeId);
+        case spv::OpTypePointer:
+            return 8;
+        case spv::OpTypeMatrix:
+        {
+            uint32_t matrixStride{0};
+            uint32_t rowMajor{0};
+            FindMember(structId, member, MemberField::MatrixStride, matrixStride);
+            FindMember(structId, member, MemberField::RowMajor, rowMajor);
+
+            const uint32_t rows = Declaration(type[2])[3];
+            const uint32_t columns = type[3];
+            return matrixStride * (rowMajor ? rows : columns);
+        }
+        }
+        return ScalarOrVectorSize(typeId);
+    }
+
+    ShaderMemberType MapMemberType(const uint32_t typeId) const
+    {
+        const uint32_t* type = Declaration(StripArrays(typeId));
+        switch (Opcode(type))
+        {
+        case spv::OpTypeFloat:
+            if (type[2] == 32) return ShaderMemberType::Float;
+            break;
+
+        case spv::OpTypeInt:
+            if (type[2] == 32) return type[3] ? ShaderMemberType::Int : ShaderMemberType::UInt;
+            break;
+
+        case spv::OpTypeVector:
+            if (!IsFloat32(type[2])) break;
+            switch (type[3])
+            {
+                case 2: return ShaderMemberType::Vec2;
+                case 3: return ShaderMemberType::Vec3;
+                case 4: return ShaderMemberType::Vec4;
+            }
+            break;
+
+        case spv::OpTypeMatrix:
+        {
+            const uint32_t* column = Declaration(type[2]);
+            if (IsFloat32(column[2]) && column[3] == 4 && type[3] == 4) return ShaderMemberType::Mat4;
+            break;
+        }
+
+        case spv::OpTypeStruct: return ShaderMemberType::Struct;
+        }
+
+        return ShaderMemberType::Unknown;
+    }
+
+    std::vector<ShaderMember> ExtractStructMembers(const uint32_t structId) const
+    {
+        const uint32_t* type = Declaration(structId);
+        const uint32_t memberCount = WordCount(type) - 2;
+
+        std::vector<ShaderMember> members;
+        members.reserve(memberCount);
+        for (uint32_t i{0}; i < memberCount; ++i)
+        {
+            const uint32_t memberTypeId = type[2 + i];
+
+            ShaderMember member;
+            member.name = MemberName(structId, i);
+            member.offset = MemberOffset(structId, i);
+            member.size = MemberSize(structId, i);
+            member.arraySize = InnermostArrayLength(memberTypeId);
+            member.type = MapMemberType(memberTypeId);
+
+            if (member.type == ShaderMemberType::Struct)
+            {
+                member.members = ExtractStructMembers(StripArrays(memberTypeId));
+            }
+
+            members.push_back(std::move(member));
+        }
+
+        return members;
+    }
+};
+
+} // anonymous namespace
+
+ShaderReflectionData ParseSpirV(const std::vector<uint32_t>& spirvCode, const VkShaderStageFlagBits stage)
+{
+    return WordStreamParser{spirvCode}.Parse(stage);
+}
+
+} // namespace velecs::graphics
@@ -0,0 +1,125 @@
+/// @file    ShaderModuleCache.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 19:21:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Shader/ShaderModuleCache.hpp"
+
+#include "velecs/graphics/Shader/SpirVHash.hpp"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void ShaderModuleCache::Init(const VkDevice device)
+{
+    _device = device;
+}
+
+void ShaderModuleCache::Cleanup()
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    for (auto& [hash, entry] : _entries)
+    {
+        vkDestroyShaderModule(_device, entry.module, nullptr);
+    }
+    _entries.clear();
+    _moduleHashes.clear();
+}
+
+VkShaderModule ShaderModuleCache::Acquire(const std::vector<uint32_t>& spirvCode, const std::string& entryPoint)
+{
+    if (spirvCode.empty())
+    {
+        throw std::runtime_error("Cannot create shader module from empty SPIR-V code");
+    }
+
+    const uint64_t hash = HashSpirV(spirvCode, entryPoint);
+
+    // Held while creating, so shaders compiled concurrently never create the same module twice
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto [begin, end] = _entries.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        Entry& entry = it->second;
+        if (entry.entryPoint == entryPoint && entry.spirvCode == spirvCode)
+        {
+            ++entry.refCount;
+            return entry.module;
+        }
+    }
+
+    VkShaderModuleCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    createInfo.pNext = nullptr;
+    createInfo.codeSize = spirvCode.size() * sizeof(uint32_t);
+    createInfo.pCode = spirvCode.data();
+
+    VkShaderModule module{VK_NULL_HANDLE};
+    VkResult result = vkCreateShaderModule(_device, &createInfo, nullptr, &module);
+    if (result != VK_SUCCESS)
+    {
+        std::ostringstream oss;
+        oss << "Failed to create shader module: " << result;
+        throw std::runtime_error(oss.str());
+    }
+
+    _entries.emplace(hash, Entry{spirvCode, entryPoint, module, 1});
+    _moduleHashes.emplace(module, hash);
+
+    return module;
+}
+
+void ShaderModuleCache::Release(const VkShaderModule module)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // Unknown after Cleanup()
+    auto hashIt = _moduleHashes.find(module);
+    if (hashIt == _moduleHashes.end()) return;
+
+    auto [begin, end] = _entries.equal_range(hashIt->second);
+    for (auto it = begin; it != end; ++it)
+    {
+        Entry& entry = it->second;
+        if (entry.module != module) continue;
+
+        if (--entry.refCount == 0)
+        {
+            vkDestroyShaderModule(_device, module, nullptr);
+            _entries.erase(it);
+            _moduleHashes.erase(hashIt);
+        }
+        return;
+    }
+}
+
+size_t ShaderModuleCache::GetModuleCount() const
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _entries.size();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
@@ -48,13 +48,21 @@ void ComputeShaderProgram::SetGroupCount(const uint32_t x, const uint32_t y/* =
     _numGroupsZ = z;
 }
 
-void ComputeShaderProgram::Init(const VkDevice device)
+void ComputeShaderProgram::Init(
+    const VkDevice device,
+    PipelineCache* const pipelineCache /* = nullptr*/,
+    ShaderModuleCache* const shaderModuleCache /* = nullptr*/,
+    PipelineLayoutCache* const pipelineLayoutCache /* = nullptr*/
+)
 {
     if (_initialized) throw std::runtime_error("Cannot call Init() more than once");
     if (device == VK_NULL_HANDLE) throw std::runtime_error("Invalid device handle");
     if (!IsComplete()) throw std::runtime_error("No compute shader was assigned");
 
     _device = device;
+    _pipelineCache = pipelineCache;
+    _shaderModuleCache = shaderModuleCache;
+    _pipelineLayoutCache = pipelineLayoutCache;
 
     InitPipelineLayout();
     InitPipeline();
@@ -74,7 +82,10 @@ void ComputeShaderProgram::Dispatch(const VkCommandBuffer cmd)
     vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
 
     // Bind the descriptor set containing the draw image for the compute pipeline
-    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _pipelineLayout, 0, 1, &_descriptorSet, 0, nullptr);
+    if (_descriptorSet != VK_NULL_HANDLE)
+    {
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _pipelineLayout, 0, 1, &_descriptorSet, 0, nullptr);
+    }
     
     // Only push constants if they are set
     if (_pushConstant.has_value())
@@ -113,11 +124,25 @@ ShaderReflectionData ComputeShaderProgram::GetReflectionData()
 
 void ComputeShaderProgram::InitPipelineLayout()
 {
+    if (_pipelineLayoutCache != nullptr)
+    {
+        std::vector<VkDescriptorSetLayout> fixedSetLayouts;
+        if (_descriptorSetLayout != VK_NULL_HANDLE) fixedSetLayouts.push_back(_descriptorSetLayout);
+
+        std::vector<VkPushConstantRange> pushConstantRanges;
+        if (_pushConstant.has_value()) pushConstantRanges.push_back(_pushConstant->GetRange());
+
+        _pipelineLayout = _pipelineLayoutCache->GetPipelineLayout(GetReflectionData(), fixedSetLayouts, pushConstantRanges);
+        return;
+    }
+
     VkPipelineLayoutCreateInfo computeLayout{};
     computeLayout.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     computeLayout.pNext = nullptr;
-    computeLayout.pSetLayouts = &_descriptorSetLayout;
-    computeLayout.setLayoutCount = 1;
+    // Programs reaching their buffers through device addresses have no descriptor set
+    const bool hasDescriptor = _descriptorSetLayout != VK_NULL_HANDLE;
+    computeLayout.pSetLayouts = hasDescriptor ? &_descriptorSetLayout : nullptr;
+    computeLayout.setLayoutCount = hasDescriptor ? 1 : 0;
     
     if (_pushConstant.has_value())
     {
@@ -137,7 +162,9 @@ void ComputeShaderProgram::InitPipeline()
     _pipeline = ComputePipelineBuilder{}
         .SetDevice(_device)
         .SetPipelineLayout(_pipelineLayout)
+        .SetPipelineCache(_pipelineCache)
         .SetComputeShader(_comp)
+        .SetShaderModuleCache(_shaderModuleCache)
         .GetPipeline()
         ;
 }
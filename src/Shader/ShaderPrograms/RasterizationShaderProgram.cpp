@@ -12,6 +12,8 @@
 
 #include "velecs/graphics/Shader/Reflection/ShaderReflector.hpp"
 
+#include <algorithm>
+
 namespace velecs::graphics {
 
 // Public Fields
@@ -67,32 +69,58 @@ void RasterizationShaderProgram::SetTessellationEvaluationShader(const std::shar
     _tese = tese;
 }
 
-void RasterizationShaderProgram::Init(const VkDevice device, const VkFormat colorAttachmentFormat)
+void RasterizationShaderProgram::SetUniformRing(const UniformRingAllocator& uniformRing, const uint32_t set)
+{
+    _uniformRingLayout = uniformRing.GetDescriptorSetLayout();
+    _uniformRingSet = set;
+}
+
+void RasterizationShaderProgram::Init(
+    const VkDevice device,
+    const VkFormat colorAttachmentFormat,
+    const VkDescriptorSetLayout bindlessLayout /* = VK_NULL_HANDLE*/,
+    PipelineCache* const pipelineCache /* = nullptr*/,
+    ShaderModuleCache* const shaderModuleCache /* = nullptr*/,
+    PipelineLayoutCache* const pipelineLayoutCache /* = nullptr*/,
+    RenderPipelineStateCache* const pipelineStateCache /* = nullptr*/
+)
 {
     if (_initialized) throw std::runtime_error("Cannot call Init() more than once");
     if (device == VK_NULL_HANDLE) throw std::runtime_error("Invalid device handle");
     if (!IsComplete()) throw std::runtime_error("Either no shaders were assigned or there is an invalid combination of shaders");
 
     _device = device;
+    _bindlessLayout = bindlessLayout;
+    _pipelineLayoutCache = pipelineLayoutCache;
+    _pipelineStateCache = pipelineStateCache;
 
     InitPipelineLayout();
 
     std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
-    if (_vert) shaderStages.push_back(_vert->GetCreateInfo(_device));
-    if (_frag) shaderStages.push_back(_frag->GetCreateInfo(_device));
-    if (_geom) shaderStages.push_back(_geom->GetCreateInfo(_device));
-    if (_tesc) shaderStages.push_back(_tesc->GetCreateInfo(_device));
-    if (_tese) shaderStages.push_back(_tese->GetCreateInfo(_device));
+    std::vector<const std::vector<uint32_t>*> shaderCode;
+    auto addStage = [&](Shader& shader) {
+        shaderStages.push_back(shader.GetCreateInfo(_device, shaderModuleCache));
+        shaderCode.push_back(&shader.GetSpirVCode());
+    };
+    if (_vert) addStage(*_vert);
+    if (_frag) addStage(*_frag);
+    if (_geom) addStage(*_geom);
+    if (_tesc) addStage(*_tesc);
+    if (_tese) addStage(*_tese);
 
     pipelineBuilder.SetDevice(_device)
         .SetPipelineLayout(_pipelineLayout)
+        .SetPipelineCache(pipelineCache)
+        .SetPipelineStateCache(pipelineStateCache)
         .SetShaders(shaderStages)
+        .SetShaderCode(shaderCode)
         .SetColorAttachmentFormat(colorAttachmentFormat)
         ;
 
     InitPipeline();
 
     _initialized = true;
+    _pipelineReady.store(true, std::memory_order_release);
 }
 
 void RasterizationShaderProgram::Draw(const VkCommandBuffer cmd, const VkExtent2D extent)
@@ -165,15 +193,54 @@ ShaderReflectionData RasterizationShaderProgram::GetReflectionData()
 
 void RasterizationShaderProgram::InitPipelineLayout()
 {
+    // Bindless resources are reflected at set 0 too, the heap layout replaces them
+    std::vector<VkDescriptorSetLayout> fixedSetLayouts;
+    if (_bindlessLayout != VK_NULL_HANDLE) fixedSetLayouts.push_back(_bindlessLayout);
+
+    if (_uniformRingLayout != VK_NULL_HANDLE)
+    {
+        if (_uniformRingSet < fixedSetLayouts.size())
+        {
+            throw std::runtime_error("The uniform ring set " + std::to_string(_uniformRingSet) + " is taken by the bindless heap");
+        }
+
+        // The ring's block reflects as a plain uniform buffer, but is bound with a dynamic offset
+        fixedSetLayouts.resize(_uniformRingSet + 1, VK_NULL_HANDLE);
+        fixedSetLayouts[_uniformRingSet] = _uniformRingLayout;
+    }
+
+    std::vector<VkPushConstantRange> pushConstantRanges;
+    if (_pushConstant.has_value()) pushConstantRanges.push_back(_pushConstant->GetRange());
+
+    if (_pipelineLayoutCache != nullptr)
+    {
+        const std::vector<VkDescriptorSetLayout> setLayouts = _pipelineLayoutCache->GetSetLayouts(GetReflectionData(), fixedSetLayouts);
+        _pipelineLayout = _pipelineLayoutCache->GetPipelineLayout(setLayouts, pushConstantRanges);
+        pipelineBuilder.SetPipelineLayoutDescription(setLayouts, pushConstantRanges);
+        return;
+    }
+
     VkPipelineLayoutCreateInfo graphicsLayout{};
     graphicsLayout.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     graphicsLayout.pNext = VK_NULL_HANDLE;
     graphicsLayout.flags = 0;
 
-    if (_pushConstant.has_value())
+    // Without the cache there are no layouts for the sets in between
+    if (std::find(fixedSetLayouts.begin(), fixedSetLayouts.end(), VK_NULL_HANDLE) != fixedSetLayouts.end())
     {
-        graphicsLayout.pPushConstantRanges = &_pushConstant->GetRange();
-        graphicsLayout.pushConstantRangeCount = 1;
+        throw std::runtime_error("Sets before the uniform ring set need a pipeline layout cache");
+    }
+
+    if (!fixedSetLayouts.empty())
+    {
+        graphicsLayout.pSetLayouts = fixedSetLayouts.data();
+        graphicsLayout.setLayoutCount = static_cast<uint32_t>(fixedSetLayouts.size());
+    }
+
+    if (!pushConstantRanges.empty())
+    {
+        graphicsLayout.pPushConstantRanges = pushConstantRanges.data();
+        graphicsLayout.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
     }
 
     VkResult result = vkCreatePipelineLayout(_device, &graphicsLayout, nullptr, &_pipelineLayout);
@@ -181,6 +248,8 @@ void RasterizationShaderProgram::InitPipelineLayout()
     {
         throw std::runtime_error("Failed to create pipeline layout: " + std::to_string(result));
     }
+
+    pipelineBuilder.SetPipelineLayoutDescription(fixedSetLayouts, pushConstantRanges);
 }
 
 void RasterizationShaderProgram::InitPipeline()
@@ -190,19 +259,25 @@ void RasterizationShaderProgram::InitPipeline()
 
 void RasterizationShaderProgram::Cleanup()
 {
+    // Released before its modules and layout, whose handles key the shared pipeline
+    if (_device != VK_NULL_HANDLE)
+    {
+        if (_pipeline != VK_NULL_HANDLE)
+        {
+            if (_pipelineStateCache != nullptr)
+                _pipelineStateCache->Release(_pipeline);
+            else
+                vkDestroyPipeline(_device, _pipeline, nullptr);
+        }
+        if (_pipelineLayout != VK_NULL_HANDLE && _pipelineLayoutCache == nullptr)
+            vkDestroyPipelineLayout(_device, _pipelineLayout, nullptr);
+    }
+
     if (_vert) _vert.reset();
     if (_geom) _geom.reset();
     if (_frag) _frag.reset();
     if (_tesc) _tesc.reset();
     if (_tese) _tese.reset();
-
-    if (_device != VK_NULL_HANDLE)
-    {
-        if (_pipelineLayout != VK_NULL_HANDLE)
-            vkDestroyPipelineLayout(_device, _pipelineLayout, nullptr);
-        if (_pipeline != VK_NULL_HANDLE)
-            vkDestroyPipeline(_device, _pipeline, nullptr);
-    }
 }
 
 } // namespace velecs::graphics
@@ -0,0 +1,96 @@
+/// @file    ShaderProgramBatch.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 18:47:05
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Shader/ShaderPrograms/ShaderProgramBatch.hpp"
+
+#include <exception>
+#include <iostream>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+ShaderProgramBatch::ShaderProgramBatch(
+    WorkerPool& workerPool,
+    const VkDevice device,
+    PipelineCache* const pipelineCache /* = nullptr*/,
+    ShaderModuleCache* const shaderModuleCache /* = nullptr*/,
+    PipelineLayoutCache* const pipelineLayoutCache /* = nullptr*/,
+    RenderPipelineStateCache* const pipelineStateCache /* = nullptr*/
+)
+    : _workerPool(workerPool), _device(device), _pipelineCache(pipelineCache), _shaderModuleCache(shaderModuleCache),
+      _pipelineLayoutCache(pipelineLayoutCache), _pipelineStateCache(pipelineStateCache) {}
+
+// Public Methods
+
+std::shared_future<void> ShaderProgramBatch::Add(ComputeShaderProgram& program)
+{
+    return Queue([this, &program]() {
+        program.Init(_device, _pipelineCache, _shaderModuleCache, _pipelineLayoutCache);
+    });
+}
+
+std::shared_future<void> ShaderProgramBatch::Add(
+    RasterizationShaderProgram& program,
+    const VkFormat colorAttachmentFormat,
+    const VkDescriptorSetLayout bindlessLayout /* = VK_NULL_HANDLE*/
+)
+{
+    return Queue([this, &program, colorAttachmentFormat, bindlessLayout]() {
+        program.Init(
+            _device,
+            colorAttachmentFormat,
+            bindlessLayout,
+            _pipelineCache,
+            _shaderModuleCache,
+            _pipelineLayoutCache,
+            _pipelineStateCache
+        );
+    });
+}
+
+bool ShaderProgramBatch::Wait()
+{
+    bool succeeded = true;
+    for (const std::shared_future<void>& future : _pending)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Failed to initialize shader program: " << e.what() << std::endl;
+            succeeded = false;
+        }
+    }
+    _pending.clear();
+
+    return succeeded;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+std::shared_future<void> ShaderProgramBatch::Queue(std::function<void()>&& job)
+{
+    std::shared_future<void> future = _workerPool.Submit(std::move(job)).share();
+    _pending.push_back(future);
+    return future;
+}
+
+} // namespace velecs::graphics
@@ -21,14 +21,20 @@ namespace velecs::graphics {
 // Constructors and Destructors
 
 Shader::Shader(Shader&& other) noexcept
-    : _stage(other._stage),
+    : _device(other._device),
+        _stage(other._stage),
         _relPath(std::move(other._relPath)),
         _entryPoint(std::move(other._entryPoint)),
         _spirvCode(std::move(other._spirvCode)),
         _module(other._module),
+        _moduleCache(other._moduleCache),
         _stageCreateInfo(other._stageCreateInfo)
 {
+    // Short entry points live inside the string, the moved create info still points into other
+    _stageCreateInfo.pName = _entryPoint.c_str();
+
     other._module = VK_NULL_HANDLE;
+    other._moduleCache = nullptr;
     other._stageCreateInfo = {};
 }
 
@@ -38,14 +44,18 @@ Shader& Shader::operator=(Shader&& other) noexcept
     {
         Cleanup();
 
+        _device = other._device;
         _stage = other._stage;
         _relPath = std::move(other._relPath);
         _entryPoint = std::move(other._entryPoint);
         _spirvCode = std::move(other._spirvCode);
         _module = other._module;
+        _moduleCache = other._moduleCache;
         _stageCreateInfo = other._stageCreateInfo;
+        _stageCreateInfo.pName = _entryPoint.c_str();
 
         other._module = VK_NULL_HANDLE;
+        other._moduleCache = nullptr;
         other._stageCreateInfo = {};
     }
     return *this;
@@ -53,10 +63,16 @@ Shader& Shader::operator=(Shader&& other) noexcept
 
 // Public Methods
 
-VkPipelineShaderStageCreateInfo Shader::GetCreateInfo(const VkDevice device)
+VkPipelineShaderStageCreateInfo Shader::GetCreateInfo(const VkDevice device, ShaderModuleCache* const moduleCache /* = nullptr*/)
 {
+    std::lock_guard<std::mutex> lock{_moduleMutex};
+
+    // Creating a module on every call leaked the previous one
+    if (_module != VK_NULL_HANDLE) return _stageCreateInfo;
+
     _device = device;
-    _module = CreateModuleFromCode(_spirvCode);
+    _moduleCache = moduleCache;
+    _module = _moduleCache != nullptr ? _moduleCache->Acquire(_spirvCode, _entryPoint) : CreateModuleFromCode(_spirvCode);
     _stageCreateInfo = VkExtPipelineShaderStageCreateInfo(_stage, _module, _entryPoint);
 
     return _stageCreateInfo;
@@ -184,11 +200,16 @@ std::vector<uint32_t> Shader::LoadSpirVFromFile(const std::filesystem::path& rel
 
 void Shader::Cleanup()
 {
-    if (_module != VK_NULL_HANDLE && _device != VK_NULL_HANDLE)
+    if (_module != VK_NULL_HANDLE && _moduleCache != nullptr)
+    {
+        _moduleCache->Release(_module);
+    }
+    else if (_module != VK_NULL_HANDLE && _device != VK_NULL_HANDLE)
     {
         vkDestroyShaderModule(_device, _module, nullptr);
-        _module = VK_NULL_HANDLE;
     }
+    _module = VK_NULL_HANDLE;
+    _moduleCache = nullptr;
     _stageCreateInfo = {};
 }
 
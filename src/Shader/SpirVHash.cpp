@@ -0,0 +1,41 @@
+/// @file    SpirVHash.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 19:58:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Shader/SpirVHash.hpp"
+
+namespace velecs::graphics {
+
+namespace {  // Anonymous namespace for private implementation
+
+const uint64_t FNV1A_PRIME = 1099511628211ull;
+
+} // anonymous namespace
+
+const uint64_t FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+
+uint64_t Fnv1a(const void* const data, const size_t size, const uint64_t hash /* = FNV1A_OFFSET_BASIS*/)
+{
+    uint64_t result = hash;
+    const uint8_t* const bytes = static_cast<const uint8_t*>(data);
+    for (size_t i{0}; i < size; ++i)
+    {
+        result ^= bytes[i];
+        result *= FNV1A_PRIME;
+    }
+    return result;
+}
+
+uint64_t HashSpirV(const std::vector<uint32_t>& spirvCode, const std::string& entryPoint)
+{
+    const uint64_t hash = Fnv1a(spirvCode.data(), spirvCode.size() * sizeof(uint32_t));
+    return Fnv1a(entryPoint.data(), entryPoint.size(), hash);
+}
+
+} // namespace velecs::graphics
@@ -0,0 +1,161 @@
+/// @file    ImageBarrierBatch.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 12:17:46
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Sync/ImageBarrierBatch.hpp"
+
+#include "velecs/graphics/VulkanInitializers.hpp"
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void ImageBarrierBatch::Transition(
+    const VkImage image,
+    ImageState& state,
+    const ImageUsage usage,
+    const bool discard /* = false*/,
+    const VkImageAspectFlags aspectMask /* = VK_IMAGE_ASPECT_COLOR_BIT*/
+)
+{
+    Transition(image, state, ImageState::FromUsage(usage), discard, aspectMask);
+}
+
+void ImageBarrierBatch::Transition(
+    const VkImage image,
+    ImageState& state,
+    const ImageState& newState,
+    const bool discard /* = false*/,
+    const VkImageAspectFlags aspectMask /* = VK_IMAGE_ASPECT_COLOR_BIT*/
+)
+{
+    const bool layoutChange = state.layout != newState.layout;
+
+    // Reads after reads in the same layout can run concurrently, only remember the new
+    // readers so the next write waits on all of them
+    if (!layoutChange && !state.HasWrites() && !newState.HasWrites())
+    {
+        state.stages |= newState.stages;
+        state.accesses |= newState.accesses;
+        return;
+    }
+
+    VkImageMemoryBarrier2 imageBarrier{};
+    imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    imageBarrier.pNext = nullptr;
+    // Only writes need to be made available, previous reads just need to finish executing
+    imageBarrier.srcStageMask = state.stages;
+    imageBarrier.srcAccessMask = ImageState::GetWriteAccesses(state.accesses);
+    imageBarrier.dstStageMask = newState.stages;
+    imageBarrier.dstAccessMask = newState.accesses;
+    imageBarrier.oldLayout = discard ? VK_IMAGE_LAYOUT_UNDEFINED : state.layout;
+    imageBarrier.newLayout = newState.layout;
+    imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    imageBarrier.image = image;
+    imageBarrier.subresourceRange = VkExtImageSubresourceRange(aspectMask);
+
+    _imageBarriers.push_back(imageBarrier);
+
+    state.layout = newState.layout;
+    state.stages = newState.stages;
+    state.accesses = newState.accesses;
+    state.queueFamily = newState.queueFamily;
+}
+
+void ImageBarrierBatch::Release(
+    const VkImage image,
+    ImageState& state,
+    const uint32_t dstQueueFamily,
+    const VkImageLayout newLayout,
+    const VkImageAspectFlags aspectMask /* = VK_IMAGE_ASPECT_COLOR_BIT*/
+)
+{
+    VkImageMemoryBarrier2 imageBarrier{};
+    imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    imageBarrier.pNext = nullptr;
+    // The destination scope is ignored for a release, the acquire on the other queue provides it
+    imageBarrier.srcStageMask = state.stages;
+    imageBarrier.srcAccessMask = ImageState::GetWriteAccesses(state.accesses);
+    imageBarrier.dstStageMask = VK_PIPELINE_STAGE_2_NONE;
+    imageBarrier.dstAccessMask = VK_ACCESS_2_NONE;
+    imageBarrier.oldLayout = state.layout;
+    imageBarrier.newLayout = newLayout;
+    imageBarrier.srcQueueFamilyIndex = state.queueFamily;
+    imageBarrier.dstQueueFamilyIndex = dstQueueFamily;
+    imageBarrier.image = image;
+    imageBarrier.subresourceRange = VkExtImageSubresourceRange(aspectMask);
+
+    _imageBarriers.push_back(imageBarrier);
+
+    state.layout = newLayout;
+    state.stages = VK_PIPELINE_STAGE_2_NONE;
+    state.accesses = VK_ACCESS_2_NONE;
+    state.queueFamily = dstQueueFamily;
+}
+
+void ImageBarrierBatch::Acquire(
+    const VkImage image,
+    ImageState& state,
+    const uint32_t srcQueueFamily,
+    const VkImageLayout oldLayout,
+    const ImageState& newState,
+    const VkImageAspectFlags aspectMask /* = VK_IMAGE_ASPECT_COLOR_BIT*/
+)
+{
+    VkImageMemoryBarrier2 imageBarrier{};
+    imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    imageBarrier.pNext = nullptr;
+    // The source scope is ignored for an acquire, the semaphore wait orders it after the release
+    imageBarrier.srcStageMask = VK_PIPELINE_STAGE_2_NONE;
+    imageBarrier.srcAccessMask = VK_ACCESS_2_NONE;
+    imageBarrier.dstStageMask = newState.stages;
+    imageBarrier.dstAccessMask = newState.accesses;
+    imageBarrier.oldLayout = oldLayout;
+    imageBarrier.newLayout = newState.layout;
+    imageBarrier.srcQueueFamilyIndex = srcQueueFamily;
+    imageBarrier.dstQueueFamilyIndex = newState.queueFamily;
+    imageBarrier.image = image;
+    imageBarrier.subresourceRange = VkExtImageSubresourceRange(aspectMask);
+
+    _imageBarriers.push_back(imageBarrier);
+
+    state.layout = newState.layout;
+    state.stages = newState.stages;
+    state.accesses = newState.accesses;
+    state.queueFamily = newState.queueFamily;
+}
+
+void ImageBarrierBatch::Flush(const VkCommandBuffer cmd)
+{
+    if (_imageBarriers.empty()) return;
+
+    VkDependencyInfo depInfo{};
+    depInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    depInfo.pNext = nullptr;
+    depInfo.imageMemoryBarrierCount = static_cast<uint32_t>(_imageBarriers.size());
+    depInfo.pImageMemoryBarriers = _imageBarriers.data();
+    vkCmdPipelineBarrier2(cmd, &depInfo);
+
+    _imageBarriers.clear();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
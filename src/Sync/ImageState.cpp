@@ -0,0 +1,131 @@
+/// @file    ImageState.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 11:52:31
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Sync/ImageState.hpp"
+
+#include <stdexcept>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+ImageState ImageState::FromUsage(const ImageUsage usage)
+{
+    ImageState state{};
+
+    switch (usage)
+    {
+        case ImageUsage::Undefined:
+            state.layout = VK_IMAGE_LAYOUT_UNDEFINED;
+            state.stages = VK_PIPELINE_STAGE_2_NONE;
+            state.accesses = VK_ACCESS_2_NONE;
+            break;
+        case ImageUsage::ComputeStorageRead:
+            state.layout = VK_IMAGE_LAYOUT_GENERAL;
+            state.stages = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+            state.accesses = VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+            break;
+        case ImageUsage::ComputeStorageWrite:
+            state.layout = VK_IMAGE_LAYOUT_GENERAL;
+            state.stages = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+            state.accesses = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
+            break;
+        case ImageUsage::ComputeStorageReadWrite:
+            state.layout = VK_IMAGE_LAYOUT_GENERAL;
+            state.stages = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+            state.accesses = VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
+            break;
+        case ImageUsage::ComputeSampledRead:
+            state.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+            state.accesses = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT;
+            break;
+        case ImageUsage::FragmentSampledRead:
+            state.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+            state.accesses = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT;
+            break;
+        case ImageUsage::ColorAttachment:
+            // Reads cover load operations and blending
+            state.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+            state.accesses = VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
+            break;
+        case ImageUsage::DepthAttachment:
+            state.layout = VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+            state.accesses = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            break;
+        case ImageUsage::BlitSrc:
+            state.layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_BLIT_BIT;
+            state.accesses = VK_ACCESS_2_TRANSFER_READ_BIT;
+            break;
+        case ImageUsage::BlitDst:
+            state.layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_BLIT_BIT;
+            state.accesses = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            break;
+        case ImageUsage::CopySrc:
+            state.layout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_COPY_BIT;
+            state.accesses = VK_ACCESS_2_TRANSFER_READ_BIT;
+            break;
+        case ImageUsage::CopyDst:
+            state.layout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            state.stages = VK_PIPELINE_STAGE_2_COPY_BIT;
+            state.accesses = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            break;
+        case ImageUsage::Present:
+            // The semaphore signaled at the end of the submission orders everything before presenting
+            state.layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+            state.stages = VK_PIPELINE_STAGE_2_NONE;
+            state.accesses = VK_ACCESS_2_NONE;
+            break;
+        default:
+            throw std::invalid_argument("Unknown image usage");
+    }
+
+    return state;
+}
+
+bool ImageState::IsWriteAccess(const VkAccessFlags2 accesses)
+{
+    return GetWriteAccesses(accesses) != VK_ACCESS_2_NONE;
+}
+
+VkAccessFlags2 ImageState::GetWriteAccesses(const VkAccessFlags2 accesses)
+{
+    constexpr VkAccessFlags2 writeAccesses{
+        VK_ACCESS_2_SHADER_WRITE_BIT
+        | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT
+        | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+        | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+        | VK_ACCESS_2_TRANSFER_WRITE_BIT
+        | VK_ACCESS_2_HOST_WRITE_BIT
+        | VK_ACCESS_2_MEMORY_WRITE_BIT
+    };
+
+    return accesses & writeAccesses;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
@@ -0,0 +1,97 @@
+/// @file    RadixSorter.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 16:08:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Threading/RadixSorter.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+const size_t RadixSorter::MIN_PACKETS_PER_TASK = 8192;
+
+// Constructors and Destructors
+
+// Public Methods
+
+void RadixSorter::Sort(std::vector<DrawPacket>& packets, WorkerPool& workerPool)
+{
+    const size_t count = packets.size();
+    if (count < 2) return;
+
+    // Bytes equal in every key do not change the order, so their passes are skipped
+    uint64_t differingBits{0};
+    const uint64_t firstKey = packets[0].key;
+    for (const DrawPacket& packet : packets) differingBits |= packet.key ^ firstKey;
+    if (differingBits == 0) return;
+
+    const size_t taskCount = std::min<size_t>(
+        workerPool.GetThreadCount() + 1,
+        (count + MIN_PACKETS_PER_TASK - 1) / MIN_PACKETS_PER_TASK
+    );
+    const size_t packetsPerTask = (count + taskCount - 1) / taskCount;
+
+    _scratch.resize(count);
+    _histograms.resize(taskCount);
+
+    DrawPacket* source = packets.data();
+    DrawPacket* destination = _scratch.data();
+
+    for (uint32_t shift{0}; shift < 64; shift += 8)
+    {
+        if (((differingBits >> shift) & 0xFF) == 0) continue;
+
+        workerPool.ParallelFor(taskCount, [&](const size_t task) {
+            Histogram& histogram = _histograms[task];
+            histogram.fill(0);
+
+            const size_t begin = task * packetsPerTask;
+            const size_t end = std::min(count, begin + packetsPerTask);
+            for (size_t i{begin}; i < end; ++i) ++histogram[(source[i].key >> shift) & 0xFF];
+        });
+
+        // A digit's packets go after every smaller digit, and after the same digit of earlier tasks
+        uint32_t offset{0};
+        for (size_t digit{0}; digit < 256; ++digit)
+        {
+            for (size_t task{0}; task < taskCount; ++task)
+            {
+                const uint32_t digitCount = _histograms[task][digit];
+                _histograms[task][digit] = offset;
+                offset += digitCount;
+            }
+        }
+
+        workerPool.ParallelFor(taskCount, [&](const size_t task) {
+            Histogram& offsets = _histograms[task];
+
+            const size_t begin = task * packetsPerTask;
+            const size_t end = std::min(count, begin + packetsPerTask);
+            for (size_t i{begin}; i < end; ++i) destination[offsets[(source[i].key >> shift) & 0xFF]++] = source[i];
+        });
+
+        std::swap(source, destination);
+    }
+
+    // An odd number of passes leaves the result in the scratch buffer
+    if (source != packets.data()) packets.swap(_scratch);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::graphics
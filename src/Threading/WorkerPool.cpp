@@ -0,0 +1,158 @@
+/// @file    WorkerPool.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 13:12:47
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Threading/WorkerPool.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <exception>
+#include <system_error>
+
+namespace velecs::graphics {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool WorkerPool::Init(const uint32_t threadCount /* = 0*/)
+{
+    uint32_t count = threadCount;
+    if (count == 0)
+    {
+        // hardware_concurrency() may return 0 if it cannot be determined
+        count = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    _stopping = false;
+    _threads.reserve(count);
+
+    try
+    {
+        for (uint32_t i{0}; i < count; ++i)
+        {
+            _threads.emplace_back(&WorkerPool::WorkerLoop, this);
+        }
+    }
+    catch (const std::system_error& e)
+    {
+        std::cerr << "Failed to start worker thread: " << e.what() << std::endl;
+        Cleanup();
+        return false;
+    }
+
+    return true;
+}
+
+void WorkerPool::Cleanup()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+
+    for (std::thread& thread : _threads)
+    {
+        if (thread.joinable()) thread.join();
+    }
+    _threads.clear();
+}
+
+std::future<void> WorkerPool::Submit(std::function<void()>&& job)
+{
+    std::packaged_task<void()> task(std::move(job));
+    std::future<void> future = task.get_future();
+
+    if (_threads.empty())
+    {
+        // Not initialized, run inline so callers waiting on the future do not deadlock
+        task();
+        return future;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.emplace_back(std::move(task));
+    }
+    _condition.notify_one();
+
+    return future;
+}
+
+void WorkerPool::ParallelFor(const size_t taskCount, const std::function<void(const size_t)>& task)
+{
+    if (taskCount == 0) return;
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(taskCount - 1);
+    for (size_t i{1}; i < taskCount; ++i)
+    {
+        futures.push_back(Submit([&task, i]() { task(i); }));
+    }
+
+    // The caller would otherwise sit idle waiting for the workers
+    std::exception_ptr exception;
+    try
+    {
+        task(0);
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    // Every task must finish before returning, they reference the caller's stack
+    for (std::future<void>& future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (...)
+        {
+            if (!exception) exception = std::current_exception();
+        }
+    }
+
+    if (exception) std::rethrow_exception(exception);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void WorkerPool::WorkerLoop()
+{
+    while (true)
+    {
+        std::packaged_task<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+
+            // Drain the queue before exiting so no future is left without a value
+            if (_jobs.empty()) return;
+
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+
+        // Exceptions are stored in the job's future
+        job();
+    }
+}
+
+} // namespace velecs::graphics
@@ -55,6 +55,16 @@ VkSemaphoreCreateInfo VkExtSemaphoreCreateInfo(const VkSemaphoreCreateFlags flag
     return semCreateInfo;
 }
 
+VkSemaphoreTypeCreateInfo VkExtSemaphoreTypeCreateInfo(const VkSemaphoreType semaphoreType, const uint64_t initialValue/* = 0*/)
+{
+    VkSemaphoreTypeCreateInfo typeCreateInfo{};
+    typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeCreateInfo.pNext = nullptr;
+    typeCreateInfo.semaphoreType = semaphoreType;
+    typeCreateInfo.initialValue = initialValue;
+    return typeCreateInfo;
+}
+
 VkCommandBufferBeginInfo VkExtCommandBufferBeginInfo(const VkCommandBufferUsageFlags flags/* = 0*/)
 {
     VkCommandBufferBeginInfo info{};
@@ -76,7 +86,7 @@ VkImageSubresourceRange VkExtImageSubresourceRange(const VkImageAspectFlags aspe
     return subImage;
 }
 
-VkSemaphoreSubmitInfo VkExtSemaphoreSubmitInfo(const VkPipelineStageFlags2 stageMask, const VkSemaphore semaphore)
+VkSemaphoreSubmitInfo VkExtSemaphoreSubmitInfo(const VkPipelineStageFlags2 stageMask, const VkSemaphore semaphore, const uint64_t value /* = 1*/)
 {
 	VkSemaphoreSubmitInfo submitInfo{};
 	submitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
@@ -84,7 +94,7 @@ VkSemaphoreSubmitInfo VkExtSemaphoreSubmitInfo(const VkPipelineStageFlags2 stage
 	submitInfo.semaphore = semaphore;
 	submitInfo.stageMask = stageMask;
 	submitInfo.deviceIndex = 0;
-	submitInfo.value = 1;
+	submitInfo.value = value;
 	return submitInfo;
 }
 
@@ -187,12 +197,14 @@ VkRenderingAttachmentInfo VkExtRenderingAttachmentInfo(
 VkRenderingInfo VkExtRenderingInfo(
     const VkExtent2D renderExtent,
     const VkRenderingAttachmentInfo* const colorAttachment,
-    const VkRenderingAttachmentInfo* const depthAttachment
+    const VkRenderingAttachmentInfo* const depthAttachment,
+    const VkRenderingFlags flags/* = 0*/
 )
 {
     VkRenderingInfo renderInfo {};
     renderInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
     renderInfo.pNext = nullptr;
+    renderInfo.flags = flags;
     renderInfo.renderArea = VkRect2D { VkOffset2D { 0, 0 }, renderExtent };
     renderInfo.layerCount = 1;
     renderInfo.colorAttachmentCount = 1;
@@ -202,6 +214,24 @@ VkRenderingInfo VkExtRenderingInfo(
     return renderInfo;
 }
 
+VkCommandBufferInheritanceRenderingInfo VkExtCommandBufferInheritanceRenderingInfo(
+    const VkFormat* const colorAttachmentFormat,
+    const VkFormat depthAttachmentFormat/* = VK_FORMAT_UNDEFINED*/
+)
+{
+    VkCommandBufferInheritanceRenderingInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO;
+    info.pNext = nullptr;
+    info.flags = 0;
+    info.viewMask = 0;
+    info.colorAttachmentCount = 1;
+    info.pColorAttachmentFormats = colorAttachmentFormat;
+    info.depthAttachmentFormat = depthAttachmentFormat;
+    info.stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+    info.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    return info;
+}
+
 
 
 
@@ -0,0 +1,200 @@
+/// @file    ShaderReflectionParityTest.cpp
+/// @author  Matthew Green
+/// @date    2026-10-16 21:37:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/graphics/Shader/Reflection/ShaderReflector.hpp"
+#include "velecs/graphics/Shader/Reflection/SpirVParser.hpp"
+#include "velecs/graphics/Shader/Shaders/ComputeShader.hpp"
+#include "velecs/graphics/Shader/Shaders/FragmentShader.hpp"
+#include "velecs/graphics/Shader/Shaders/GeometryShader.hpp"
+#include "velecs/graphics/Shader/Shaders/TessellationControlShader.hpp"
+#include "velecs/graphics/Shader/Shaders/TessellationEvaluationShader.hpp"
+#include "velecs/graphics/Shader/Shaders/VertexShader.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace velecs::graphics;
+
+namespace {  // Anonymous namespace for private implementation
+
+/// @brief Counts the differences it reports, a shader passes when none were found.
+class DiffReporter {
+public:
+    explicit DiffReporter(const std::filesystem::path& shaderPath) : _shaderPath(shaderPath) {}
+
+    template <typename T>
+    void Compare(const std::string& field, const T& parsed, const T& reference)
+    {
+        if (parsed == reference) return;
+
+        std::cerr << _shaderPath.string() << ": " << field
+            << " is " << parsed << ", SPIRV-Cross reflects " << reference << std::endl;
+        ++_diffCount;
+    }
+
+    void CompareMembers(const std::string& path, const std::vector<ShaderMember>& parsed, const std::vector<ShaderMember>& reference)
+    {
+        Compare(path + ".members.size()", parsed.size(), reference.size());
+
+        const size_t count = std::min(parsed.size(), reference.size());
+        for (size_t i{0}; i < count; ++i)
+        {
+            const std::string memberPath = path + "." + reference[i].name;
+            Compare(memberPath + ".name", parsed[i].name, reference[i].name);
+            Compare(memberPath + ".offset", parsed[i].offset, reference[i].offset);
+            Compare(memberPath + ".size", parsed[i].size, reference[i].size);
+            Compare(memberPath + ".arraySize", parsed[i].arraySize, reference[i].arraySize);
+            Compare(memberPath + ".type", static_cast<uint32_t>(parsed[i].type), static_cast<uint32_t>(reference[i].type));
+            CompareMembers(memberPath, parsed[i].members, reference[i].members);
+        }
+    }
+
+    void CompareResources(const std::string& path, std::vector<ShaderResource> parsed, std::vector<ShaderResource> reference)
+    {
+        // The parser lists variables in declaration order, SPIRV-Cross in id order
+        auto order = [](const ShaderResource& a, const ShaderResource& b) {
+            return std::tie(a.set, a.binding, a.name) < std::tie(b.set, b.binding, b.name);
+        };
+        std::sort(parsed.begin(), parsed.end(), order);
+        std::sort(reference.begin(), reference.end(), order);
+
+        Compare(path + ".size()", parsed.size(), reference.size());
+
+        const size_t count = std::min(parsed.size(), reference.size());
+        for (size_t i{0}; i < count; ++i)
+        {
+            const std::string resourcePath = path + "[" + reference[i].name + "]";
+            Compare(resourcePath + ".type", static_cast<uint32_t>(parsed[i].type), static_cast<uint32_t>(reference[i].type));
+            Compare(resourcePath + ".stages", parsed[i].stages, reference[i].stages);
+            Compare(resourcePath + ".name", parsed[i].name, reference[i].name);
+            Compare(resourcePath + ".offset", parsed[i].offset, reference[i].offset);
+            Compare(resourcePath + ".size", parsed[i].size, reference[i].size);
+            Compare(resourcePath + ".set", parsed[i].set, reference[i].set);
+            Compare(resourcePath + ".binding", parsed[i].binding, reference[i].binding);
+            Compare(resourcePath + ".arraySize", parsed[i].arraySize, reference[i].arraySize);
+            CompareMembers(resourcePath, parsed[i].members, reference[i].members);
+        }
+    }
+
+    inline size_t GetDiffCount() const { return _diffCount; }
+
+private:
+    std::filesystem::path _shaderPath;
+    size_t _diffCount{0};
+};
+
+std::vector<uint32_t> ReadSpirV(const std::filesystem::path& path)
+{
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    if (!file) throw std::runtime_error("Failed to open " + path.string());
+
+    const std::streamsize size = file.tellg();
+    if (size <= 0 || size % sizeof(uint32_t) != 0) throw std::runtime_error("Invalid SPIR-V file size: " + path.string());
+
+    std::vector<uint32_t> code(static_cast<size_t>(size) / sizeof(uint32_t));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(code.data()), size);
+    return code;
+}
+
+/// @brief Creates a shader of the stage named by the file, e.g. sky.comp.spv is a compute shader.
+std::shared_ptr<Shader> MakeShader(const std::filesystem::path& path, const std::vector<uint32_t>& code)
+{
+    const std::string stage = path.stem().extension().string();
+    if (stage == ".vert") return VertexShader::FromCode(code);
+    if (stage == ".tesc") return TessellationControlShader::FromCode(code);
+    if (stage == ".tese") return TessellationEvaluationShader::FromCode(code);
+    if (stage == ".geom") return GeometryShader::FromCode(code);
+    if (stage == ".frag") return FragmentShader::FromCode(code);
+    if (stage == ".comp") return ComputeShader::FromCode(code);
+    return nullptr;
+}
+
+/// @brief Reflects one shader with both backends.
+/// @return Number of differences found.
+size_t CheckShader(const std::filesystem::path& path)
+{
+    const std::vector<uint32_t> code = ReadSpirV(path);
+
+    const std::shared_ptr<Shader> shader = MakeShader(path, code);
+    if (!shader)
+    {
+        std::cout << "Skipping " << path.string() << ", its stage is not named by the file" << std::endl;
+        return 0;
+    }
+
+    const ShaderReflectionData parsed = ParseSpirV(code, shader->GetStage());
+    const ShaderReflectionData reference = ReflectWithSpirVCross(*shader);
+
+    DiffReporter reporter{path};
+    reporter.CompareResources("uniformBuffers", parsed.uniformBuffers, reference.uniformBuffers);
+    reporter.CompareResources("storageImages", parsed.storageImages, reference.storageImages);
+    reporter.CompareResources("sampledImages", parsed.sampledImages, reference.sampledImages);
+    reporter.CompareResources("pushConstants", parsed.pushConstants, reference.pushConstants);
+    return reporter.GetDiffCount();
+}
+
+} // anonymous namespace
+
+/// @brief Reflects every .spv file under the given directories with the built-in parser and
+///        SPIRV-Cross, and fails on any difference.
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <shader directory>..." << std::endl;
+        return 2;
+    }
+
+    size_t shaderCount{0};
+    size_t failedCount{0};
+    for (int i{1}; i < argc; ++i)
+    {
+        const std::filesystem::path directory{argv[i]};
+        if (!std::filesystem::is_directory(directory))
+        {
+            std::cerr << "Not a directory: " << directory.string() << std::endl;
+            return 2;
+        }
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+        {
+            if (!entry.is_regular_file() || entry.path().extension() != ".spv") continue;
+
+            ++shaderCount;
+            try
+            {
+                if (CheckShader(entry.path()) > 0) ++failedCount;
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << entry.path().string() << ": " << e.what() << std::endl;
+                ++failedCount;
+            }
+        }
+    }
+
+    if (shaderCount == 0)
+    {
+        std::cerr << "No SPIR-V files found" << std::endl;
+        return 1;
+    }
+
+    std::cout << shaderCount - failedCount << "/" << shaderCount << " shaders reflect identically" << std::endl;
+    return failedCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+/// @file    images.frag
+/// @author  Matthew Green
+/// @date    2026-10-16 22:05:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#version 460
+
+#extension GL_EXT_nonuniform_qualifier : require
+
+// Reflection fixture: sampled images, fixed, specialized and runtime sized image arrays
+
+layout(constant_id = 0) const uint SHADOW_CASCADE_COUNT = 4u;
+
+layout(set = 0, binding = 0) uniform sampler2D albedo;
+layout(set = 0, binding = 1) uniform sampler2D detailMaps[8];
+layout(set = 0, binding = 2) uniform sampler2DShadow shadowMaps[SHADOW_CASCADE_COUNT];
+layout(set = 0, binding = 3) uniform samplerCube environment;
+
+layout(set = 1, binding = 0) uniform Material {
+    vec4 baseColor;
+    float roughness;
+    float metallic;
+    uint textureIndex;
+} material;
+
+// Bindless heap, its descriptor count is only known at runtime
+layout(set = 2, binding = 0) uniform sampler2D textures[];
+
+// Starts after the vertex stage range
+layout(push_constant) uniform Push {
+    layout(offset = 80) vec4 tint;
+    uint detailIndex;
+    uint cascade;
+} push;
+
+layout(location = 0) in vec3 inColor;
+layout(location = 1) in vec2 inUV;
+layout(location = 2) in vec3 inShadowCoord;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    vec4 base = texture(albedo, inUV) * texture(textures[nonuniformEXT(material.textureIndex)], inUV);
+    vec4 detail = texture(detailMaps[push.detailIndex % 8u], inUV * 4.0);
+    float shadow = texture(shadowMaps[push.cascade % SHADOW_CASCADE_COUNT], inShadowCoord);
+    vec3 reflection = texture(environment, reflect(-inColor, vec3(0.0, 1.0, 0.0))).rgb * material.metallic;
+
+    outColor = material.baseColor * push.tint * base * detail * shadow
+        + vec4(reflection * (1.0 - material.roughness), 0.0);
+}
@@ -0,0 +1,72 @@
+/// @file    uniforms.vert
+/// @author  Matthew Green
+/// @date    2026-10-16 22:04:37
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#version 460
+
+// Reflection fixture: uniform buffers with matrices, row-major members, arrays and nested structs
+
+struct Light {
+    vec4 position;
+    vec3 color;
+    float range;
+};
+
+layout(set = 0, binding = 0) uniform Camera {
+    mat4 view;
+    mat4 projection;
+    layout(row_major) mat4 viewProjection;
+    vec4 frustumPlanes[6];
+    vec3 position;
+    float time;
+} camera;
+
+// Anonymous instance, reflected under its block name
+layout(set = 0, binding = 1) uniform Lights {
+    Light lights[4];
+    uint lightCount;
+    int frame;
+};
+
+// Array of uniform buffers, one descriptor per element
+layout(set = 1, binding = 0) uniform Model {
+    mat4 model;
+    layout(row_major) mat3 normalMatrix;
+    vec2 uvScale[2];
+    bool visible;
+} models[3];
+
+layout(push_constant) uniform Push {
+    mat4 transform;
+    uint modelIndex;
+    float scale;
+} push;
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+
+layout(location = 0) out vec3 outColor;
+
+void main()
+{
+    mat4 model = models[1].model * push.transform;
+    vec4 worldPosition = model * vec4(inPosition * push.scale, 1.0);
+
+    vec3 color = vec3(0.0);
+    for (uint i = 0; i < lightCount; ++i)
+    {
+        vec3 toLight = lights[i].position.xyz - worldPosition.xyz;
+        float attenuation = clamp(1.0 - length(toLight) / lights[i].range, 0.0, 1.0);
+        color += lights[i].color * attenuation * max(dot(models[2].normalMatrix * inNormal, normalize(toLight)), 0.0);
+    }
+
+    float visible = models[0].visible && dot(camera.frustumPlanes[frame % 6], worldPosition) > 0.0 ? 1.0 : 0.0;
+    outColor = color * visible + camera.position * models[push.modelIndex % 3u].uvScale[1].x * sin(camera.time);
+    gl_Position = camera.viewProjection * camera.projection * camera.view * worldPosition;
+}